@@ -8,7 +8,6 @@
  **/
 
 #include <iostream>
-#include <locale>
 #include <cstddef>
 #include <string>
 #include <variant>
@@ -127,10 +126,6 @@ class ExampleClass : public ExampleSettings {
 
 int main() {
 
-  // make sure to always use the same decimal point separator
-  std::locale::global(std::locale("C"));
-
-
   const std::string file = "ExampleClass.xml";
 
   ExampleClass exampleClass;
@@ -0,0 +1,614 @@
+/**
+ * @file binary.hpp
+ * @brief Contains the compact binary format the Settings class can save to and load from instead of xml.
+ *
+ * Layout (all integers little endian):
+ *   header: "STNG" | uint16 version | uint16 reserved (0) | uint32 entry count
+ *   entry:  uint32 name length | name | uint32 type tag | uint32 payload length | payload
+ * The payload holds the value (or the N values of an array) back to back:
+ *   bool, char:          1 byte
+ *   wchar_t:             uint32 code point
+ *   numbers:             sizeof(T) bytes
+ *   std::string:         uint32 length | bytes
+ *   std::wstring:        uint32 length | uint32 code point per character
+ *   std::pair:           first | second
+ *   containers:          uint32 count | elements (maps: key | value per element)
+ * Unordered containers write their elements sorted by the encoded bytes, so
+ * equal containers give equal bytes whatever their bucket order is.
+ * Numbers are stored with the size of the registered type, so both sides must
+ * use the same types. The type tag (see binaryTypeTag()) detects entries whose
+ * type changed, also between types of the same size like float and int32. The
+ * payload length allows skipping unknown entries.
+ *
+ * @date 16.10.2026
+ * @author Jakob Wandel
+ * @version 1.0
+ **/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <list>
+#include <map>
+#include <set>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace util {
+
+namespace detail {
+
+constexpr uint32_t TYPE_TAG_OFFSET = 2166136261U;
+constexpr uint32_t TYPE_TAG_PRIME  = 16777619U;
+
+/**
+ * @brief Mixes the value into the tag (FNV-1a over its 4 bytes).
+ **/
+constexpr uint32_t mixTypeTag(uint32_t tag, uint32_t value) {
+  for (int byte = 0; byte < 4; ++byte) {
+    tag ^= (value >> (8 * byte)) & 0xFFU;
+    tag *= TYPE_TAG_PRIME;
+  }
+  return tag;
+}
+
+constexpr uint32_t typeTagOf(char kind) {
+  return mixTypeTag(TYPE_TAG_OFFSET, static_cast<uint32_t>(kind));
+}
+
+// Types with the same encoding share a tag: a std::vector entry can be
+// loaded into a std::list.
+template <class T>
+struct BinaryTypeTag;
+
+template <>
+struct BinaryTypeTag<bool> {
+  static constexpr uint32_t value = typeTagOf('b');
+};
+
+template <>
+struct BinaryTypeTag<char> {
+  static constexpr uint32_t value = typeTagOf('c');
+};
+
+template <>
+struct BinaryTypeTag<wchar_t> {
+  static constexpr uint32_t value = typeTagOf('w');
+};
+
+template <class T>
+  requires std::is_arithmetic_v<T>
+struct BinaryTypeTag<T> {
+  static constexpr char KIND = std::is_floating_point_v<T> ? 'f'
+                               : std::is_signed_v<T>       ? 'i'
+                                                           : 'u';
+  static constexpr uint32_t value = mixTypeTag(typeTagOf(KIND), sizeof(T));
+};
+
+template <>
+struct BinaryTypeTag<std::string> {
+  static constexpr uint32_t value = typeTagOf('s');
+};
+
+template <>
+struct BinaryTypeTag<std::wstring> {
+  static constexpr uint32_t value = typeTagOf('S');
+};
+
+template <class T1, class T2>
+struct BinaryTypeTag<std::pair<T1, T2>> {
+  static constexpr uint32_t value =
+    mixTypeTag(mixTypeTag(typeTagOf('p'), BinaryTypeTag<std::remove_const_t<T1>>::value),
+               BinaryTypeTag<T2>::value);
+};
+
+template <class T>
+struct SequenceTypeTag {
+  static constexpr uint32_t value = mixTypeTag(typeTagOf('q'), BinaryTypeTag<T>::value);
+};
+
+template <class T>
+struct SetTypeTag {
+  static constexpr uint32_t value = mixTypeTag(typeTagOf('e'), BinaryTypeTag<T>::value);
+};
+
+template <class T>
+struct BinaryTypeTag<std::vector<T>> : SequenceTypeTag<T> {};
+
+template <class T>
+struct BinaryTypeTag<std::list<T>> : SequenceTypeTag<T> {};
+
+template <class T>
+struct BinaryTypeTag<std::set<T>> : SetTypeTag<T> {};
+
+template <class T>
+struct BinaryTypeTag<std::multiset<T>> : SetTypeTag<T> {};
+
+template <class T>
+struct BinaryTypeTag<std::unordered_set<T>> : SetTypeTag<T> {};
+
+// Maps are sets of pairs.
+template <class T1, class T2>
+struct BinaryTypeTag<std::map<T1, T2>> : SetTypeTag<std::pair<T1, T2>> {};
+
+template <class T1, class T2>
+struct BinaryTypeTag<std::multimap<T1, T2>> : SetTypeTag<std::pair<T1, T2>> {};
+
+template <class T1, class T2>
+struct BinaryTypeTag<std::unordered_map<T1, T2>> : SetTypeTag<std::pair<T1, T2>> {};
+
+template <class T1, class T2>
+struct BinaryTypeTag<std::unordered_multimap<T1, T2>> : SetTypeTag<std::pair<T1, T2>> {};
+
+}  // namespace detail
+
+/**
+ * @brief The type tag stored with each entry. Equal for types with the same
+ * encoding, different otherwise (e.g. float and int32, int and unsigned).
+ * T The type of one value of the entry.
+ **/
+template <class T>
+constexpr uint32_t binaryTypeTag() {
+  return detail::BinaryTypeTag<T>::value;
+}
+
+/**
+ * @brief Writes values in the binary format into a growing byte buffer.
+ **/
+class BinaryWriter {
+ public:
+  static constexpr std::array<char, 4> MAGIC = {'S', 'T', 'N', 'G'};
+  static constexpr uint16_t VERSION          = 2;
+
+  /**
+   * @brief Writes the header, must be the first call.
+   * @param entry_count The number of entries which will follow.
+   **/
+  void writeHeader(size_t entry_count) {
+    writeBytes(MAGIC.data(), MAGIC.size());
+    writeNumber(VERSION);
+    writeNumber(uint16_t{0});
+    writeLength(entry_count);
+  }
+
+  /**
+   * @brief Starts an entry. The payload is written with write() afterwards.
+   * @param name The name of the entry.
+   * @param type_tag The binaryTypeTag() of the values.
+   * @return The position of the payload length, to be passed to endEntry().
+   **/
+  [[nodiscard]] size_t beginEntry(std::string_view name, uint32_t type_tag) {
+    write(name);
+    writeNumber(type_tag);
+    const size_t length_position = buffer.size();
+    writeNumber(uint32_t{0});
+    return length_position;
+  }
+
+  /**
+   * @brief Finishes an entry by patching its payload length.
+   * @param length_position The value returned by beginEntry().
+   **/
+  void endEntry(size_t length_position) {
+    const size_t payload_begin = length_position + sizeof(uint32_t);
+    const uint32_t length      = checkedLength(buffer.size() - payload_begin);
+    storeLittleEndian(length, buffer.data() + length_position);
+  }
+
+  void write(bool value) { buffer.push_back(value ? char{1} : char{0}); }
+
+  void write(char value) { buffer.push_back(value); }
+
+  void write(wchar_t value) { writeNumber(static_cast<uint32_t>(value)); }
+
+  template <class T>
+    requires std::is_arithmetic_v<T>
+  void write(T value) {
+    writeNumber(value);
+  }
+
+  void write(std::string_view value) {
+    writeLength(value.size());
+    writeBytes(value.data(), value.size());
+  }
+
+  void write(const std::string& value) { write(std::string_view(value)); }
+
+  void write(const std::wstring& value) {
+    writeLength(value.size());
+    for (const wchar_t character : value) {
+      write(character);
+    }
+  }
+
+  template <class T1, class T2>
+  void write(const std::pair<T1, T2>& value) {
+    write(value.first);
+    write(value.second);
+  }
+
+  template <class T>
+  void write(const std::vector<T>& value) {
+    writeContainer(value);
+  }
+
+  template <class T>
+  void write(const std::list<T>& value) {
+    writeContainer(value);
+  }
+
+  template <class T>
+  void write(const std::set<T>& value) {
+    writeContainer(value);
+  }
+
+  template <class T>
+  void write(const std::multiset<T>& value) {
+    writeContainer(value);
+  }
+
+  template <class T>
+  void write(const std::unordered_set<T>& value) {
+    writeUnorderedContainer(value);
+  }
+
+  template <class T1, class T2>
+  void write(const std::map<T1, T2>& value) {
+    writeContainer(value);
+  }
+
+  template <class T1, class T2>
+  void write(const std::multimap<T1, T2>& value) {
+    writeContainer(value);
+  }
+
+  template <class T1, class T2>
+  void write(const std::unordered_map<T1, T2>& value) {
+    writeUnorderedContainer(value);
+  }
+
+  template <class T1, class T2>
+  void write(const std::unordered_multimap<T1, T2>& value) {
+    writeUnorderedContainer(value);
+  }
+
+  [[nodiscard]] const std::vector<char>& bytes() const { return buffer; }
+
+  [[nodiscard]] std::vector<char> release() { return std::move(buffer); }
+
+  // Drops the written bytes but keeps the memory for reuse.
+  void clear() { buffer.clear(); }
+
+  /**
+   * @brief Stores the number in little endian byte order.
+   * @param value The number to store.
+   * @param destination At least sizeof(T) bytes.
+   **/
+  template <class T>
+  static void storeLittleEndian(T value, char* destination) {
+    std::memcpy(destination, &value, sizeof(T));
+    if constexpr (std::endian::native == std::endian::big) {
+      std::reverse(destination, destination + sizeof(T));
+    }
+  }
+
+ private:
+  template <class Container>
+  void writeContainer(const Container& container) {
+    writeLength(container.size());
+    for (const auto& element : container) {
+      write(element);
+    }
+  }
+
+  // The iteration order of unordered containers depends on their insertion
+  // history. Sorting the encoded elements keeps equal containers byte equal.
+  template <class Container>
+  void writeUnorderedContainer(const Container& container) {
+    writeLength(container.size());
+    const size_t begin = buffer.size();
+    std::vector<std::pair<size_t, size_t>> elements;  // offset, length
+    elements.reserve(container.size());
+    for (const auto& element : container) {
+      const size_t element_begin = buffer.size();
+      write(element);
+      elements.emplace_back(element_begin - begin, buffer.size() - element_begin);
+    }
+    const std::vector<char> encoded(buffer.begin() + static_cast<std::ptrdiff_t>(begin),
+                                    buffer.end());
+    const auto view = [&encoded](const std::pair<size_t, size_t>& element) {
+      return std::string_view(encoded.data() + element.first, element.second);
+    };
+    std::sort(elements.begin(), elements.end(), [&view](const auto& lhs, const auto& rhs) {
+      return view(lhs) < view(rhs);
+    });
+    buffer.resize(begin);
+    for (const auto& element : elements) {
+      writeBytes(encoded.data() + element.first, element.second);
+    }
+  }
+
+  template <class T>
+  void writeNumber(T value) {
+    const size_t position = buffer.size();
+    buffer.resize(position + sizeof(T));
+    storeLittleEndian(value, buffer.data() + position);
+  }
+
+  void writeLength(size_t length) { writeNumber(checkedLength(length)); }
+
+  void writeBytes(const char* bytes, size_t count) {
+    buffer.insert(buffer.end(), bytes, bytes + count);
+  }
+
+  [[nodiscard]] static uint32_t checkedLength(size_t length) {
+    assert("BinaryWriter: lengths are limited to 32 bit." &&
+           length <= std::numeric_limits<uint32_t>::max());
+    return static_cast<uint32_t>(length);
+  }
+
+  std::vector<char> buffer;
+};
+
+/**
+ * @brief Reads values in the binary format from a caller owned buffer. A
+ * failed read (not enough bytes, bad value) puts the reader into a failed
+ * state: all following reads fail too and ok() returns false.
+ **/
+class BinaryReader {
+ public:
+  explicit BinaryReader(std::span<const char> bytes)
+      : data(bytes) {}
+
+  /**
+   * @brief Reads and checks the header, must be the first call.
+   * @param entry_count Set to the number of entries which follow.
+   * @return true if the magic and version are known.
+   **/
+  [[nodiscard]] bool readHeader(uint32_t& entry_count) {
+    std::array<char, BinaryWriter::MAGIC.size()> magic{};
+    if (!readBytes(magic.data(), magic.size()) || magic != BinaryWriter::MAGIC) {
+      return fail();
+    }
+    uint16_t version  = 0;
+    uint16_t reserved = 0;
+    if (!readNumber(version) || !readNumber(reserved) || version != BinaryWriter::VERSION) {
+      return fail();
+    }
+    return readNumber(entry_count);
+  }
+
+  /**
+   * @brief Reads the next entry.
+   * @param name Set to the name, points into the buffer.
+   * @param type_tag Set to the binaryTypeTag() of the values.
+   * @param payload Set to the payload, points into the buffer.
+   * @return true if a complete entry was read.
+   **/
+  [[nodiscard]] bool readEntry(std::string_view& name, uint32_t& type_tag, std::span<const char>& payload) {
+    uint32_t length = 0;
+    if (!readNumber(length) || !skip(length)) {
+      return false;
+    }
+    name = std::string_view(data.data() + position - length, length);
+    if (!readNumber(type_tag) || !readNumber(length) || !skip(length)) {
+      return false;
+    }
+    payload = data.subspan(position - length, length);
+    return true;
+  }
+
+  [[nodiscard]] bool read(bool& value) {
+    char byte = 0;
+    if (!readBytes(&byte, 1) || (byte != 0 && byte != 1)) {
+      return fail();
+    }
+    value = byte == 1;
+    return true;
+  }
+
+  [[nodiscard]] bool read(char& value) { return readBytes(&value, 1); }
+
+  [[nodiscard]] bool read(wchar_t& value) {
+    uint32_t code_point = 0;
+    if (!readNumber(code_point)) {
+      return false;
+    }
+    value = static_cast<wchar_t>(code_point);
+    return true;
+  }
+
+  template <class T>
+    requires std::is_arithmetic_v<T>
+  [[nodiscard]] bool read(T& value) {
+    return readNumber(value);
+  }
+
+  [[nodiscard]] bool read(std::string& value) {
+    uint32_t length = 0;
+    if (!readNumber(length) || !skip(length)) {
+      return false;
+    }
+    value.assign(data.data() + position - length, length);
+    return true;
+  }
+
+  [[nodiscard]] bool read(std::wstring& value) {
+    uint32_t length = 0;
+    if (!readLength(length, sizeof(uint32_t))) {
+      return false;
+    }
+    value.resize(length);
+    for (wchar_t& character : value) {
+      if (!read(character)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  template <class T1, class T2>
+  [[nodiscard]] bool read(std::pair<T1, T2>& value) {
+    return read(value.first) && read(value.second);
+  }
+
+  template <class T>
+  [[nodiscard]] bool read(std::vector<T>& value) {
+    return readSequence(value);
+  }
+
+  template <class T>
+  [[nodiscard]] bool read(std::list<T>& value) {
+    return readSequence(value);
+  }
+
+  template <class T>
+  [[nodiscard]] bool read(std::set<T>& value) {
+    return readAssociative<T>(value);
+  }
+
+  template <class T>
+  [[nodiscard]] bool read(std::multiset<T>& value) {
+    return readAssociative<T>(value);
+  }
+
+  template <class T>
+  [[nodiscard]] bool read(std::unordered_set<T>& value) {
+    return readAssociative<T>(value);
+  }
+
+  template <class T1, class T2>
+  [[nodiscard]] bool read(std::map<T1, T2>& value) {
+    return readAssociative<std::pair<T1, T2>>(value);
+  }
+
+  template <class T1, class T2>
+  [[nodiscard]] bool read(std::multimap<T1, T2>& value) {
+    return readAssociative<std::pair<T1, T2>>(value);
+  }
+
+  template <class T1, class T2>
+  [[nodiscard]] bool read(std::unordered_map<T1, T2>& value) {
+    return readAssociative<std::pair<T1, T2>>(value);
+  }
+
+  template <class T1, class T2>
+  [[nodiscard]] bool read(std::unordered_multimap<T1, T2>& value) {
+    return readAssociative<std::pair<T1, T2>>(value);
+  }
+
+  /**
+   * @return true if no read failed so far.
+   **/
+  [[nodiscard]] bool ok() const { return !failed; }
+
+  /**
+   * @return true if no read failed and every byte was consumed.
+   **/
+  [[nodiscard]] bool done() const { return !failed && position == data.size(); }
+
+ private:
+  template <class Container>
+  [[nodiscard]] bool readSequence(Container& container) {
+    uint32_t count = 0;
+    if (!readLength(count, 1)) {
+      return false;
+    }
+    container.resize(count);
+    for (auto& element : container) {
+      if (!read(element)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  template <class Element, class Container>
+  [[nodiscard]] bool readAssociative(Container& container) {
+    uint32_t count = 0;
+    if (!readLength(count, 1)) {
+      return false;
+    }
+    container.clear();
+    auto insertion_hint = container.begin();
+    for (uint32_t i = 0; i < count; ++i) {
+      Element element;
+      if (!read(element)) {
+        return false;
+      }
+      insertion_hint = container.insert(insertion_hint, std::move(element));
+    }
+    return true;
+  }
+
+  /**
+   * @brief Reads an element count and checks it against the remaining bytes,
+   * so a corrupted count does not allocate more than the buffer could hold.
+   * @param count Set to the count.
+   * @param min_element_size The smallest number of bytes one element needs.
+   **/
+  [[nodiscard]] bool readLength(uint32_t& count, size_t min_element_size) {
+    if (!readNumber(count)) {
+      return false;
+    }
+    if (count > (data.size() - position) / min_element_size) {
+      return fail();
+    }
+    return true;
+  }
+
+  template <class T>
+  [[nodiscard]] bool readNumber(T& value) {
+    if (failed || data.size() - position < sizeof(T)) {
+      return fail();
+    }
+    std::array<char, sizeof(T)> bytes{};
+    std::memcpy(bytes.data(), data.data() + position, sizeof(T));
+    if constexpr (std::endian::native == std::endian::big) {
+      std::reverse(bytes.begin(), bytes.end());
+    }
+    std::memcpy(&value, bytes.data(), sizeof(T));
+    position += sizeof(T);
+    return true;
+  }
+
+  [[nodiscard]] bool readBytes(char* destination, size_t count) {
+    if (!skip(count)) {
+      return false;
+    }
+    std::memcpy(destination, data.data() + position - count, count);
+    return true;
+  }
+
+  [[nodiscard]] bool skip(size_t count) {
+    if (failed || data.size() - position < count) {
+      return fail();
+    }
+    position += count;
+    return true;
+  }
+
+  [[nodiscard]] bool fail() {
+    failed = true;
+    return false;
+  }
+
+  std::span<const char> data;
+  size_t position = 0;
+  bool failed     = false;
+};
+
+}  // namespace util
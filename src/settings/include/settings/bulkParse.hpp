@@ -0,0 +1,253 @@
+/**
+ * @file bulkParse.hpp
+ * @brief Contains the bulk parser for whitespace separated numbers (packed arrays), with SSE4.2 and AVX2 kernels selected at runtime.
+ *
+ * The text is indexed in blocks of 64 bytes: a kernel computes a bit mask of
+ * the whitespace characters in the block, and the tokens are found with bit
+ * scans on that mask instead of testing every character. Each token is then
+ * converted with parseNumber() (std::from_chars), so all levels accept
+ * exactly the same input.
+ *
+ * @date 16.10.2026
+ * @author Jakob Wandel
+ * @version 1.0
+ **/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string_view>
+
+#include <settings/charconv.hpp>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define SETTINGS_HAS_X86_SIMD 1
+#include <immintrin.h>
+#else
+#define SETTINGS_HAS_X86_SIMD 0
+#endif
+
+namespace util {
+
+/**
+ * @brief The instruction set used to index the text.
+ **/
+enum class SimdLevel {
+  Scalar,
+  Sse42,
+  Avx2,
+};
+
+/**
+ * @return A printable name of the level.
+ **/
+[[nodiscard]] constexpr const char* simdLevelName(SimdLevel level) {
+  switch (level) {
+    case SimdLevel::Scalar:
+      return "scalar";
+    case SimdLevel::Sse42:
+      return "SSE4.2";
+    case SimdLevel::Avx2:
+      return "AVX2";
+  }
+  return "unknown";
+}
+
+/**
+ * @return The best level the cpu supports, detected once.
+ **/
+[[nodiscard]] inline SimdLevel detectSimdLevel() {
+#if SETTINGS_HAS_X86_SIMD
+  static const SimdLevel level = [] {
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+      return SimdLevel::Avx2;
+    }
+    if (__builtin_cpu_supports("sse4.2")) {
+      return SimdLevel::Sse42;
+    }
+    return SimdLevel::Scalar;
+  }();
+  return level;
+#else
+  return SimdLevel::Scalar;
+#endif
+}
+
+namespace detail {
+
+constexpr size_t BLOCK_SIZE = 64;
+
+[[nodiscard]] constexpr bool isWhitespace(char c) {
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+/**
+ * @brief Bit i is set if block[i] is whitespace.
+ **/
+[[nodiscard]] inline uint64_t whitespaceMaskScalar(const char* block) {
+  uint64_t mask = 0;
+  for (size_t i = 0; i < BLOCK_SIZE; ++i) {
+    mask |= static_cast<uint64_t>(isWhitespace(block[i])) << i;
+  }
+  return mask;
+}
+
+#if SETTINGS_HAS_X86_SIMD
+[[nodiscard]] __attribute__((target("sse4.2"))) inline uint64_t whitespaceMaskSse42(const char* block) {
+  // PCMPESTRM with "equal any": one instruction tests 16 bytes against the set.
+  const __m128i set = _mm_setr_epi8(' ', '\t', '\n', '\r', 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+  constexpr int SET_SIZE = 4;
+  constexpr int MODE     = _SIDD_UBYTE_OPS | _SIDD_CMP_EQUAL_ANY | _SIDD_BIT_MASK;
+  uint64_t mask          = 0;
+  for (size_t i = 0; i < BLOCK_SIZE / 16; ++i) {
+    const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + i * 16));  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast) intrinsic
+    const __m128i found = _mm_cmpestrm(set, SET_SIZE, chunk, 16, MODE);
+    mask |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_cvtsi128_si32(found))) << (i * 16);
+  }
+  return mask;
+}
+
+[[nodiscard]] __attribute__((target("avx2"))) inline uint32_t whitespaceMaskAvx2(__m256i chunk) {
+  const __m256i space   = _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(' '));
+  const __m256i tab     = _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('\t'));
+  const __m256i newline = _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('\n'));
+  const __m256i ret     = _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('\r'));
+  const __m256i any = _mm256_or_si256(_mm256_or_si256(space, tab), _mm256_or_si256(newline, ret));
+  return static_cast<uint32_t>(_mm256_movemask_epi8(any));
+}
+
+[[nodiscard]] __attribute__((target("avx2"))) inline uint64_t whitespaceMaskAvx2(const char* block) {
+  const __m256i low  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block));  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast) intrinsic
+  const __m256i high = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + 32));  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast) intrinsic
+  return static_cast<uint64_t>(whitespaceMaskAvx2(low)) |
+         (static_cast<uint64_t>(whitespaceMaskAvx2(high)) << 32U);
+}
+#endif
+
+template <SimdLevel Level>
+[[nodiscard]] inline uint64_t whitespaceMask(const char* block) {
+#if SETTINGS_HAS_X86_SIMD
+  if constexpr (Level == SimdLevel::Avx2) {
+    return whitespaceMaskAvx2(block);
+  } else if constexpr (Level == SimdLevel::Sse42) {
+    return whitespaceMaskSse42(block);
+  }
+#endif
+  return whitespaceMaskScalar(block);
+}
+
+/**
+ * @brief Finds whitespace and non whitespace characters through the
+ * whitespace mask of the current 64 byte block.
+ **/
+template <SimdLevel Level>
+class WhitespaceIndex {
+ public:
+  explicit WhitespaceIndex(std::string_view source_text)
+      : text(source_text) {}
+
+  /**
+   * @return The position of the first (non) whitespace character at or after
+   * position, or text.size() if there is none.
+   **/
+  template <bool Whitespace>
+  [[nodiscard]] size_t next(size_t position) {
+    while (position < text.size()) {
+      const size_t block      = position / BLOCK_SIZE;
+      const uint64_t mask     = maskOf(block);
+      const uint64_t matching = (Whitespace ? mask : ~mask) >> (position % BLOCK_SIZE);
+      if (matching != 0) {
+        return std::min(position + static_cast<size_t>(std::countr_zero(matching)), text.size());
+      }
+      position = (block + 1) * BLOCK_SIZE;
+    }
+    return text.size();
+  }
+
+ private:
+  [[nodiscard]] uint64_t maskOf(size_t block) {
+    if (block != cached_block) {
+      cached_block       = block;
+      const size_t begin = block * BLOCK_SIZE;
+      if (text.size() - begin >= BLOCK_SIZE) {
+        cached_mask = whitespaceMask<Level>(text.data() + begin);
+      } else {
+        // The last block is padded with whitespace, loads stay in bounds.
+        std::array<char, BLOCK_SIZE> padded{};
+        padded.fill(' ');
+        std::memcpy(padded.data(), text.data() + begin, text.size() - begin);
+        cached_mask = whitespaceMask<Level>(padded.data());
+      }
+    }
+    return cached_mask;
+  }
+
+  std::string_view text;
+  size_t cached_block  = static_cast<size_t>(-1);
+  uint64_t cached_mask = 0;
+};
+
+template <SimdLevel Level, CharconvNumber T>
+[[nodiscard]] bool parseNumbers(std::string_view text, std::span<T> values) {
+  WhitespaceIndex<Level> index(text);
+  size_t position = 0;
+  for (T& value : values) {
+    const size_t begin = index.template next<false>(position);
+    if (begin == text.size()) {
+      return false;
+    }
+    position = index.template next<true>(begin);
+    if (!parseNumber(text.substr(begin, position - begin), value)) {
+      return false;
+    }
+  }
+  return index.template next<false>(position) == text.size();
+}
+
+}  // namespace detail
+
+/**
+ * @brief Parses exactly values.size() whitespace separated numbers, each
+ * with the rules of parseNumber(), using the given instruction set.
+ *
+ * @tparam T The number type.
+ * @param text The text holding the numbers.
+ * @param values Receives the numbers. Partly written if parsing fails.
+ * @param level The instruction set, must be supported by the cpu (see detectSimdLevel()).
+ * @return true if the text held exactly values.size() valid numbers.
+ **/
+template <CharconvNumber T>
+[[nodiscard]] bool parseNumbers(std::string_view text, std::span<T> values, SimdLevel level) {
+  switch (level) {
+    case SimdLevel::Avx2:
+      return detail::parseNumbers<SimdLevel::Avx2>(text, values);
+    case SimdLevel::Sse42:
+      return detail::parseNumbers<SimdLevel::Sse42>(text, values);
+    case SimdLevel::Scalar:
+      break;
+  }
+  return detail::parseNumbers<SimdLevel::Scalar>(text, values);
+}
+
+/**
+ * @brief Parses exactly values.size() whitespace separated numbers using the
+ * best instruction set of the cpu.
+ *
+ * @tparam T The number type.
+ * @param text The text holding the numbers.
+ * @param values Receives the numbers. Partly written if parsing fails.
+ * @return true if the text held exactly values.size() valid numbers.
+ **/
+template <CharconvNumber T>
+[[nodiscard]] bool parseNumbers(std::string_view text, std::span<T> values) {
+  return parseNumbers(text, values, detectSimdLevel());
+}
+
+}  // namespace util
@@ -0,0 +1,132 @@
+/**
+ * @file charconv.hpp
+ * @brief Contains locale independent number parsing and formatting used by the Settings class to read and write numbers as text.
+ *
+ * @date 16.10.2026
+ * @author Jakob Wandel
+ * @version 1.0
+ **/
+
+#pragma once
+
+#include <array>
+#include <charconv>
+#include <concepts>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+
+namespace util {
+
+/**
+ * @brief The number types which are parsed with std::from_chars.
+ **/
+template <class T>
+concept CharconvNumber = std::is_arithmetic_v<T> && !std::same_as<T, bool> &&
+                         !std::same_as<T, char> && !std::same_as<T, wchar_t>;
+
+/**
+ * @brief Removes the whitespace tinyxml2 keeps around text.
+ * @param text The text to trim.
+ * @return The text without leading and trailing ' ', '\t', '\n', '\r'.
+ **/
+[[nodiscard]] constexpr std::string_view trimWhitespace(std::string_view text) {
+  constexpr std::string_view WHITESPACE = " \t\n\r";
+  const size_t begin                    = text.find_first_not_of(WHITESPACE);
+  if (begin == std::string_view::npos) {
+    return {};
+  }
+  const size_t end = text.find_last_not_of(WHITESPACE);
+  return text.substr(begin, end - begin + 1);
+}
+
+/**
+ * @brief Parses a number with std::from_chars, which does not depend on the
+ * global locale. Accepts what tinyxml2's Query*Text accepts for well formed
+ * numbers: surrounding whitespace, a leading '+' and (for integers) a "0x"
+ * hex prefix. Unlike sscanf the whole token must be consumed, so trailing
+ * garbage, overflow and negative values for unsigned types are errors.
+ *
+ * @tparam T The number type.
+ * @param text The text holding exactly one number.
+ * @param value Set to the parsed number on success, untouched otherwise.
+ * @return true if the text was a valid number for T.
+ **/
+template <CharconvNumber T>
+[[nodiscard]] bool parseNumber(std::string_view text, T& value) {
+  text = trimWhitespace(text);
+  if (text.size() > 1 && text.front() == '+' && text[1] != '-') {
+    text.remove_prefix(1);
+  }
+  const char* begin = text.data();
+  const char* end   = text.data() + text.size();
+
+  T parsed{};
+  std::from_chars_result result{};
+  if constexpr (std::is_integral_v<T>) {
+    if (text.size() > 2 && text[0] == '0' && (text[1] == 'x' || text[1] == 'X')) {
+      if (text[2] == '-' || text[2] == '+') {
+        return false;
+      }
+      result = std::from_chars(begin + 2, end, parsed, 16);
+    } else {
+      result = std::from_chars(begin, end, parsed);
+    }
+  } else {
+    result = std::from_chars(begin, end, parsed);
+  }
+
+  if (result.ec != std::errc() || result.ptr != end || begin == end) {
+    return false;
+  }
+  value = parsed;
+  return true;
+}
+
+/**
+ * @brief Stack buffer for formatNumber(). Large enough for every
+ * CharconvNumber in its shortest form plus the terminating null.
+ **/
+using NumberBuffer = std::array<char, 32>;
+
+/**
+ * @brief Formats a number with std::to_chars, which does not depend on the
+ * global locale. Floating point numbers are written in the shortest form
+ * which parses back (with parseNumber()) to the exact same value.
+ *
+ * @tparam T The number type.
+ * @param value The number to format.
+ * @param buffer The buffer to write into.
+ * @return Pointer to the null terminated text inside buffer.
+ **/
+template <CharconvNumber T>
+[[nodiscard]] const char* formatNumber(T value, NumberBuffer& buffer) {
+  // leave one char for the terminating null.
+  const std::to_chars_result result =
+    std::to_chars(buffer.data(), buffer.data() + buffer.size() - 1, value);
+  *result.ptr = '\0';
+  return buffer.data();
+}
+
+/**
+ * @brief Appends the numbers separated by a single space, each in the form
+ * formatNumber() writes.
+ *
+ * @tparam T The number type.
+ * @param values The numbers to append.
+ * @param text The text to append to.
+ **/
+template <CharconvNumber T>
+void appendNumbers(std::span<const T> values, std::string& text) {
+  NumberBuffer buffer;
+  for (size_t i = 0; i < values.size(); ++i) {
+    if (i > 0) {
+      text.push_back(' ');
+    }
+    text += formatNumber(values[i], buffer);
+  }
+}
+
+}  // namespace util
@@ -0,0 +1,177 @@
+/**
+ * @file codec.hpp
+ * @brief Contains the interface a storage format (codec) must provide to be used by the Settings class.
+ *
+ * @date 16.10.2026
+ * @author Jakob Wandel
+ * @version 1.0
+ **/
+
+#pragma once
+
+#include <codecvt>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <filesystem>
+#include <locale>
+#include <span>
+#include <string>
+#include <string_view>
+
+#include <settings/fileIo.hpp>
+
+namespace util {
+
+/**
+ * @brief Result of reading one stored value.
+ **/
+enum class CodecStatus {
+  Ok,
+  // The entry exists but holds no value (e.g. an empty xml element). The
+  // variable keeps its value, put() does not throw.
+  NoValue,
+  // The stored value could not be converted into the variable.
+  Invalid,
+};
+
+/**
+ * @brief Result of loading a whole document.
+ **/
+enum class DocumentStatus {
+  Ok,
+  // There is no document (yet), the codec starts an empty one.
+  NotFound,
+  Empty,
+  // These can not be handled by the Settings class, it throws.
+  CouldNotOpen,
+  ReadError,
+  ParseError,
+};
+
+/**
+ * @brief A storage format of the Settings class, selected at compile time.
+ *
+ * The codec owns the loaded document. Top level entries are accessed through
+ * an Entry handle which is default constructed (nullptr) if there is no
+ * entry. Additionally to the requirements below, the codec must provide
+ * for every type T registered with Settings::put<T>():
+ *   CodecStatus read(Entry entry, T* values, int size);
+ *   void write(Entry entry, T* values, int size);
+ * which read or write the variable (or array of size variables) pointed to.
+ * Settings::put<T>() takes pointers to their instantiations for T, so they
+ * are resolved statically.
+ **/
+template <class Codec>
+concept SettingsCodec =
+  std::default_initializable<Codec> &&
+  requires(Codec codec,
+           const Codec const_codec,
+           typename Codec::Entry entry,
+           std::string_view name,
+           std::span<const char> buffer,
+           const std::filesystem::path& path,
+           FileLoadMode load_mode,
+           int* values) {
+    { codec.loadFile(path, load_mode) } -> std::same_as<DocumentStatus>;
+    { codec.loadBuffer(buffer) } -> std::same_as<DocumentStatus>;
+    // Starts an empty document, root_name is the name of the Settings class.
+    { codec.clear(name) };
+    { codec.saveFile(path) } -> std::same_as<bool>;
+    // Description of the last error for exception messages.
+    { const_codec.errorText() } -> std::convertible_to<std::string>;
+
+    { codec.find(name) } -> std::same_as<typename Codec::Entry>;
+    { codec.firstEntry() } -> std::same_as<typename Codec::Entry>;
+    { codec.nextEntry(entry) } -> std::same_as<typename Codec::Entry>;
+    { Codec::entryName(entry) } -> std::convertible_to<std::string_view>;
+    // Appends a new entry, handles of other entries stay valid until the
+    // next appendEntry().
+    { codec.appendEntry(name) } -> std::same_as<typename Codec::Entry>;
+
+    // Hash of the stored form of the entry (name excluded), equal for equal
+    // text. Used to skip unchanged entries on a differential reload.
+    { Codec::entryHash(entry) } -> std::same_as<size_t>;
+
+    { codec.read(entry, values, 1) } -> std::same_as<CodecStatus>;
+    { codec.write(entry, values, 1) };
+  };
+
+/**
+ * @brief A codec which can also save without changing its document: the
+ * values are printed directly into the text of the file, see
+ * Settings::saveStreaming(). And load without building the document of the
+ * whole file: the entries are handed over one by one, see
+ * Settings::reloadAllStreaming(). Additionally, the StreamPrinter must provide for
+ * every type T registered with Settings::put<T>():
+ *   void write(const std::string& name, const T* values, int size);
+ * which prints the entry of the variable like write() would store it.
+ **/
+template <class Codec>
+concept StreamingCodec =
+  SettingsCodec<Codec> &&
+  requires(Codec codec,
+           const Codec const_codec,
+           typename Codec::StreamPrinter printer,
+           typename Codec::Entry entry,
+           const std::filesystem::path& path,
+           bool (*take)(std::string_view),
+           void (*load_entry)(typename Codec::Entry),
+           void (*print_entries)(typename Codec::StreamPrinter&)) {
+    // Hands the taken entries to load_entry, only the others stay in the document.
+    { codec.loadStreaming(path, take, load_entry) } -> std::same_as<DocumentStatus>;
+    // Prints the entries stored in the document unchanged.
+    { printer.copy(entry) };
+    { printer.text() } -> std::convertible_to<std::string_view>;
+    // Prints the whole document, print_entries prints the top level entries.
+    { const_codec.printStreaming(printer, print_entries) };
+  };
+
+/**
+ * @brief The StreamPrinter of a StreamingCodec, an empty type for other codecs.
+ **/
+template <class Codec>
+struct StreamPrinterOf {
+  struct type {};
+};
+
+template <StreamingCodec Codec>
+struct StreamPrinterOf<Codec> {
+  using type = typename Codec::StreamPrinter;
+};
+
+/**
+ * @brief Mixes the hash of the next part into the hash of the parts before.
+ * @param seed The hash so far.
+ * @param part The hash of the next part.
+ **/
+inline void hashCombine(size_t& seed, size_t part) {
+  constexpr size_t GOLDEN_RATIO = 0x9e3779b97f4a7c15ULL;
+  constexpr unsigned SHIFT_LEFT  = 6;
+  constexpr unsigned SHIFT_RIGHT = 2;
+  seed ^= part + GOLDEN_RATIO + (seed << SHIFT_LEFT) + (seed >> SHIFT_RIGHT);
+}
+
+/**
+ * @brief Converts a wstring to a UTF-8 encoded string.
+ * @param input The wide string.
+ * @return The UTF-8 string.
+ **/
+inline std::string castFromWstring(const std::wstring& input) {
+  // Convert wstring to string using a wide-to-UTF-8 conversion
+  std::wstring_convert<std::codecvt_utf8<wchar_t>, wchar_t> converter;
+  return converter.to_bytes(input);
+}
+
+/**
+ * @brief Converts a UTF-8 encoded string to a wstring.
+ * @param input The UTF-8 string.
+ * @return The wide string.
+ **/
+inline std::wstring castToWstring(const std::string& input) {
+  // Convert string to wstring using a UTF-8-to-wide conversion
+  std::wstring_convert<std::codecvt_utf8<wchar_t>, wchar_t> converter;
+  return converter.from_bytes(input);
+}
+
+}  // namespace util
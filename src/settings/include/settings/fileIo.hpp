@@ -0,0 +1,224 @@
+/**
+ * @file fileIo.hpp
+ * @brief Contains low level file helpers used by the Settings class to read and write its source file.
+ *
+ * @date 16.10.2026
+ * @author Jakob Wandel
+ * @version 1.0
+ **/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <filesystem>
+#include <string>
+#include <system_error>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define SETTINGS_HAS_MMAP 1
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define SETTINGS_HAS_FSYNC 1
+#else
+#define SETTINGS_HAS_MMAP 0
+#define SETTINGS_HAS_FSYNC 0
+#endif
+
+namespace util {
+
+/**
+ * @brief How the Settings class reads its source file.
+ **/
+enum class FileLoadMode {
+  // XMLDocument::LoadFile(): fopen, measure, allocate and fread the whole file.
+  Buffered,
+  // Map the file read-only and parse from the mapping. Falls back to Buffered
+  // for files which can not be mapped (pipes, devices, no mmap support).
+  MemoryMapped,
+};
+
+/**
+ * @brief How the Settings class writes its source file. The atomic levels
+ * write a temporary file next to the source file and rename it over the
+ * source, so readers and a crash see either the old or the new file.
+ **/
+enum class SaveDurability {
+  // Overwrite the file in place. A crash while writing leaves a truncated file.
+  Direct,
+  // Temporary file and rename. After a power loss the new content might not
+  // have reached the disk yet.
+  Atomic,
+  // Atomic, and the temporary file is fsynced before the rename.
+  AtomicSyncFile,
+  // AtomicSyncFile, and the directory is fsynced after the rename, so the
+  // rename itself survives a power loss.
+  AtomicSyncAll,
+};
+
+namespace detail {
+
+/**
+ * @brief Flushes the file or directory to the disk. Does nothing if fsync is
+ * not supported.
+ * @param path The file or directory.
+ * @return true on success.
+ **/
+[[nodiscard]] inline bool syncToDisk(const std::filesystem::path& path) {
+#if SETTINGS_HAS_FSYNC
+  const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);  // NOLINT(cppcoreguidelines-pro-type-vararg) POSIX API
+  if (fd < 0) {
+    return false;
+  }
+  const bool synced = ::fsync(fd) == 0;
+  ::close(fd);
+  return synced;
+#else
+  static_cast<void>(path);
+  return true;
+#endif
+}
+
+/**
+ * @return A name for a temporary file next to the given file, unique within
+ * the process and among processes.
+ **/
+[[nodiscard]] inline std::filesystem::path temporarySibling(const std::filesystem::path& file) {
+  static std::atomic<unsigned> counter{0};
+#if SETTINGS_HAS_FSYNC
+  const std::string process = std::to_string(::getpid());
+#else
+  const std::string process = "0";
+#endif
+  std::filesystem::path temporary = file;
+  temporary += ".tmp." + process + "." + std::to_string(counter.fetch_add(1));
+  return temporary;
+}
+
+}  // namespace detail
+
+/**
+ * @brief Writes a file with the given durability.
+ * @param file The file to (over)write.
+ * @param durability See SaveDurability.
+ * @param write_file Callable bool(const std::filesystem::path&) which writes
+ * the whole content into the given path, returns false on failure.
+ * @return true if the file was written. On failure with an atomic level the
+ * file is unchanged and the temporary file is removed.
+ **/
+template <class WriteFile>
+[[nodiscard]] bool writeFile(const std::filesystem::path& file, SaveDurability durability, WriteFile&& write_file) {
+  if (durability == SaveDurability::Direct) {
+    return write_file(file);
+  }
+
+  const std::filesystem::path temporary = detail::temporarySibling(file);
+  std::error_code error;
+  bool written = write_file(temporary);
+  if (written && std::filesystem::exists(file, error)) {
+    // Keep the permissions of the file we replace.
+    std::filesystem::permissions(
+      temporary, std::filesystem::status(file, error).permissions(), error);
+  }
+  if (written && durability != SaveDurability::Atomic) {
+    written = detail::syncToDisk(temporary);
+  }
+  if (written) {
+    std::filesystem::rename(temporary, file, error);
+    written = !error;
+  }
+  if (!written) {
+    std::filesystem::remove(temporary, error);
+    return false;
+  }
+  if (durability == SaveDurability::AtomicSyncAll) {
+    const std::filesystem::path directory = file.parent_path().empty() ? "." : file.parent_path();
+    return detail::syncToDisk(directory);
+  }
+  return true;
+}
+
+/**
+ * @brief Maps a regular file read-only into memory for the lifetime of the
+ * object.
+ **/
+class MappedFile {
+ public:
+  enum class Status {
+    Ok,
+    NotFound,
+    CouldNotOpen,
+    // Not a regular file or mapping is not supported: use the buffered path.
+    NotMappable,
+    Empty,
+  };
+
+  /**
+   * @brief Opens and maps the given file. Check status() before using data().
+   * @param path The file to map.
+   **/
+  explicit MappedFile(const std::filesystem::path& path) {
+#if SETTINGS_HAS_MMAP
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);  // NOLINT(cppcoreguidelines-pro-type-vararg) POSIX API
+    if (fd < 0) {
+      status_ = errno == ENOENT ? Status::NotFound : Status::CouldNotOpen;
+      return;
+    }
+
+    struct stat file_stat {};
+    if (::fstat(fd, &file_stat) != 0 || !S_ISREG(file_stat.st_mode)) {
+      ::close(fd);
+      status_ = Status::NotMappable;
+      return;
+    }
+    if (file_stat.st_size == 0) {
+      ::close(fd);
+      status_ = Status::Empty;
+      return;
+    }
+
+    size_ = static_cast<size_t>(file_stat.st_size);
+    void* mapping = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    // The mapping stays valid after closing the descriptor.
+    ::close(fd);
+    if (mapping == MAP_FAILED) {
+      size_   = 0;
+      status_ = Status::NotMappable;
+      return;
+    }
+    // The parser reads the file front to back exactly once.
+    ::madvise(mapping, size_, MADV_SEQUENTIAL);
+    data_   = static_cast<const char*>(mapping);
+    status_ = Status::Ok;
+#else
+    static_cast<void>(path);
+#endif
+  }
+
+  ~MappedFile() {
+#if SETTINGS_HAS_MMAP
+    if (data_ != nullptr) {
+      ::munmap(const_cast<char*>(data_), size_);  // NOLINT(cppcoreguidelines-pro-type-const-cast) munmap takes void*
+    }
+#endif
+  }
+
+  MappedFile(const MappedFile&)            = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+  MappedFile(MappedFile&&)                 = delete;
+  MappedFile& operator=(MappedFile&&)      = delete;
+
+  [[nodiscard]] Status status() const { return status_; }
+  [[nodiscard]] const char* data() const { return data_; }
+  [[nodiscard]] size_t size() const { return size_; }
+
+ private:
+  Status status_    = Status::NotMappable;
+  const char* data_ = nullptr;
+  size_t size_      = 0;
+};
+
+}  // namespace util
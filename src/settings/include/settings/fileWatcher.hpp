@@ -0,0 +1,295 @@
+/**
+ * @file fileWatcher.hpp
+ * @brief Contains the watcher which reports changes of the source file of the Settings class.
+ *
+ * @date 16.10.2026
+ * @author Jakob Wandel
+ * @version 1.0
+ **/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <utility>
+
+#if defined(__linux__)
+#define SETTINGS_HAS_INOTIFY 1
+#include <cerrno>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#define SETTINGS_HAS_INOTIFY 0
+#endif
+
+namespace util {
+
+/**
+ * @brief Watches one file and calls a callback once the file changed. The
+ * directory of the file is watched, so replacing the file (write a temporary
+ * file and rename it over the file, like editors and SaveDurability::Atomic
+ * do) is seen as well as writing it in place. Bursts of events are debounced:
+ * the callback runs once no event came in for the debounce time.
+ * Changes written by the owner can be suppressed with an OwnWrite.
+ * Only supported on Linux (inotify), elsewhere status() is NotSupported.
+ **/
+class FileWatcher {
+ public:
+  enum class Status {
+    Ok,
+    // The directory of the file does not exist or can not be watched.
+    CouldNotWatch,
+    NotSupported,
+  };
+
+  /**
+   * @brief Starts watching. Check status(), the callback is never called
+   * unless it is Ok.
+   * @param file The file to watch, it does not need to exist.
+   * @param debounce Time without events before the callback is called.
+   * @param on_change Called on the thread of the watcher after the file
+   * changed.
+   **/
+  FileWatcher(const std::filesystem::path& file,
+              std::chrono::milliseconds debounce,
+              std::function<void()> on_change)
+      : file_name(file.filename().string()),
+        path(file),
+        debounce_ms(static_cast<int>(debounce.count())),
+        callback(std::move(on_change)) {
+#if SETTINGS_HAS_INOTIFY
+    std::filesystem::path directory = file.parent_path();
+    if (directory.empty()) {
+      directory = ".";
+    }
+    inotify_fd = ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    stop_fd    = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (inotify_fd < 0 || stop_fd < 0 ||
+        ::inotify_add_watch(inotify_fd, directory.c_str(), WATCHED_EVENTS) < 0) {
+      status_ = Status::CouldNotWatch;
+      return;
+    }
+    status_ = Status::Ok;
+    thread  = std::thread([this] { run(); });
+#endif
+  }
+
+  ~FileWatcher() {
+#if SETTINGS_HAS_INOTIFY
+    if (thread.joinable()) {
+      const uint64_t stop = 1;
+      static_cast<void>(::write(stop_fd, &stop, sizeof(stop)));
+      thread.join();
+    }
+    if (inotify_fd >= 0) {
+      ::close(inotify_fd);
+    }
+    if (stop_fd >= 0) {
+      ::close(stop_fd);
+    }
+#endif
+  }
+
+  FileWatcher(const FileWatcher&)            = delete;
+  FileWatcher& operator=(const FileWatcher&) = delete;
+  FileWatcher(FileWatcher&&)                 = delete;
+  FileWatcher& operator=(FileWatcher&&)      = delete;
+
+  [[nodiscard]] Status status() const { return status_; }
+
+  /**
+   * @brief Marks a write of the file by the owner for as long as it exists:
+   * the debounced events are held back meanwhile, and afterwards the state
+   * the owner left the file in is remembered. If the file still has this
+   * state when the events are handled, the callback is not called.
+   * Construct it before writing the file.
+   **/
+  class OwnWrite {
+   public:
+    /**
+     * @param file_watcher The watcher of the file, may be nullptr.
+     **/
+    explicit OwnWrite(FileWatcher* file_watcher)
+        : watcher(file_watcher) {
+      if (watcher != nullptr) {
+        watcher->beginOwnWrite();
+      }
+    }
+
+    ~OwnWrite() {
+      if (watcher != nullptr) {
+        watcher->recordOwnWrite();
+      }
+    }
+
+    OwnWrite(const OwnWrite&)            = delete;
+    OwnWrite& operator=(const OwnWrite&) = delete;
+    OwnWrite(OwnWrite&&)                 = delete;
+    OwnWrite& operator=(OwnWrite&&)      = delete;
+
+   private:
+    FileWatcher* watcher;
+  };
+
+  /**
+   * @brief Holds the debounced events back until recordOwnWrite(), see
+   * OwnWrite. Call it before writing the file.
+   **/
+  void beginOwnWrite() {
+    const std::lock_guard<std::mutex> lock(mutex);
+    ++own_writes_in_progress;
+  }
+
+  /**
+   * @brief Remembers the current state of the file as written by the owner
+   * and ends the write started by beginOwnWrite(), see OwnWrite. Call it
+   * right after writing the file.
+   **/
+  void recordOwnWrite() {
+    const std::lock_guard<std::mutex> lock(mutex);
+    own_write = signatureOf(path);
+    if (own_writes_in_progress > 0) {
+      --own_writes_in_progress;
+    }
+  }
+
+  /**
+   * @return true if the file changed since the last call.
+   **/
+  [[nodiscard]] bool takeChange() { return changed.exchange(false); }
+
+ private:
+  /**
+   * @brief Identifies one state of the file: a replaced file has a new inode,
+   * a file written in place a new modification time or size.
+   **/
+  struct Signature {
+    uint64_t device            = 0;
+    uint64_t inode             = 0;
+    int64_t size               = 0;
+    int64_t modified_ns        = 0;
+    bool operator==(const Signature&) const = default;
+  };
+
+  [[nodiscard]] static std::optional<Signature> signatureOf(const std::filesystem::path& file) {
+#if SETTINGS_HAS_INOTIFY
+    struct stat file_stat {};
+    if (::stat(file.c_str(), &file_stat) != 0) {
+      return std::nullopt;
+    }
+    constexpr int64_t NS_PER_S = 1000000000;
+    return Signature{static_cast<uint64_t>(file_stat.st_dev),
+                     static_cast<uint64_t>(file_stat.st_ino),
+                     static_cast<int64_t>(file_stat.st_size),
+                     static_cast<int64_t>(file_stat.st_mtim.tv_sec) * NS_PER_S +
+                       static_cast<int64_t>(file_stat.st_mtim.tv_nsec)};
+#else
+    static_cast<void>(file);
+    return std::nullopt;
+#endif
+  }
+
+#if SETTINGS_HAS_INOTIFY
+  // Written in place (close after write), renamed over (moved to) or newly
+  // created. IN_MODIFY is left out, it fires while the file is half written.
+  static constexpr uint32_t WATCHED_EVENTS = IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE;
+
+  /**
+   * @brief Reads all queued events.
+   * @return true if one of them concerns the watched file.
+   **/
+  [[nodiscard]] bool readEvents() const {
+    bool concerns_file = false;
+    alignas(inotify_event) std::array<char, 4096> buffer{};
+    while (true) {
+      const ssize_t length = ::read(inotify_fd, buffer.data(), buffer.size());
+      if (length <= 0) {
+        return concerns_file;
+      }
+      for (ssize_t offset = 0; offset < length;) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) inotify API
+        const auto* event = reinterpret_cast<const inotify_event*>(buffer.data() + offset);
+        if (event->len > 0 && file_name == static_cast<const char*>(event->name)) {
+          concerns_file = true;
+        }
+        offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+      }
+    }
+  }
+
+  void run() {
+    std::array<pollfd, 2> fds{{{inotify_fd, POLLIN, 0}, {stop_fd, POLLIN, 0}}};
+    bool pending = false;
+    while (true) {
+      // Without pending events sleep until something happens, otherwise until
+      // the debounce time passed without new events.
+      const int ready = ::poll(fds.data(), fds.size(), pending ? debounce_ms : -1);
+      if (ready < 0 && errno != EINTR) {
+        return;
+      }
+      if ((fds[1].revents & POLLIN) != 0) {
+        return;
+      }
+      if ((fds[0].revents & POLLIN) != 0) {
+        pending = readEvents() || pending;
+        continue;
+      }
+      if (ready == 0 && pending) {
+        // Held back during a write of the owner, checked again after the
+        // next debounce time.
+        pending = !notify();
+      }
+    }
+  }
+
+  /**
+   * @brief Handles the debounced events.
+   * @return false if they are held back because the owner writes the file.
+   **/
+  [[nodiscard]] bool notify() {
+    {
+      const std::lock_guard<std::mutex> lock(mutex);
+      if (own_writes_in_progress > 0) {
+        return false;
+      }
+      const std::optional<Signature> current = signatureOf(path);
+      if (current.has_value() && current == own_write) {
+        return true;
+      }
+    }
+    changed = true;
+    if (callback) {
+      callback();
+    }
+    return true;
+  }
+
+  int inotify_fd = -1;
+  int stop_fd    = -1;
+#endif
+
+  const std::string file_name;
+  const std::filesystem::path path;
+  const int debounce_ms;
+  const std::function<void()> callback;
+
+  Status status_ = Status::NotSupported;
+  std::atomic<bool> changed{false};
+  std::mutex mutex;
+  std::optional<Signature> own_write;
+  int own_writes_in_progress = 0;
+  std::thread thread;
+};
+
+}  // namespace util
@@ -0,0 +1,978 @@
+/**
+ * @file jsonCodec.hpp
+ * @brief Contains the json storage format (codec) of the Settings class.
+ *
+ * @date 16.10.2026
+ * @author Jakob Wandel
+ * @version 1.0
+ **/
+
+#pragma once
+
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <list>
+#include <map>
+#include <set>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <settings/charconv.hpp>
+#include <settings/codec.hpp>
+#include <settings/fileIo.hpp>
+
+namespace util {
+
+struct JsonMember;
+
+/**
+ * @brief A minimal json document tree. Numbers keep their text, so they are
+ * converted only once, directly into the type of the variable.
+ **/
+struct JsonValue {
+  enum class Type { Null, Bool, Number, String, Array, Object };
+
+  Type type    = Type::Null;
+  bool boolean = false;
+  // The number token or the decoded string.
+  std::string text;
+  std::vector<JsonValue> array;
+  std::vector<JsonMember> object;
+};
+
+struct JsonMember {
+  std::string name;
+  JsonValue value;
+};
+
+/**
+ * @brief Parses json text into a JsonValue. Strict: no comments, no trailing
+ * commas, nothing but whitespace after the value.
+ **/
+class JsonParser {
+ public:
+  explicit JsonParser(std::string_view json)
+      : text(json) {}
+
+  /**
+   * @brief Parses the whole text.
+   * @param value Set to the parsed document.
+   * @return true if the text is valid json.
+   **/
+  [[nodiscard]] bool parse(JsonValue& value) {
+    skipWhitespace();
+    if (!parseValue(value, 0)) {
+      return false;
+    }
+    skipWhitespace();
+    return position == text.size();
+  }
+
+ private:
+  // Bounds the recursion for malicious input.
+  static constexpr int MAX_DEPTH = 256;
+
+  [[nodiscard]] bool parseValue(JsonValue& value, int depth) {
+    if (position == text.size() || depth > MAX_DEPTH) {
+      return false;
+    }
+    switch (text[position]) {
+      case '{':
+        return parseObject(value, depth);
+      case '[':
+        return parseArray(value, depth);
+      case '"':
+        value.type = JsonValue::Type::String;
+        return parseString(value.text);
+      case 't':
+        value.type    = JsonValue::Type::Bool;
+        value.boolean = true;
+        return consume("true");
+      case 'f':
+        value.type    = JsonValue::Type::Bool;
+        value.boolean = false;
+        return consume("false");
+      case 'n':
+        value.type = JsonValue::Type::Null;
+        return consume("null");
+      default:
+        return parseNumber(value);
+    }
+  }
+
+  [[nodiscard]] bool parseObject(JsonValue& value, int depth) {
+    value.type = JsonValue::Type::Object;
+    ++position;
+    skipWhitespace();
+    if (consume("}")) {
+      return true;
+    }
+    while (true) {
+      JsonMember& member = value.object.emplace_back();
+      skipWhitespace();
+      if (position == text.size() || text[position] != '"' || !parseString(member.name)) {
+        return false;
+      }
+      skipWhitespace();
+      if (!consume(":")) {
+        return false;
+      }
+      skipWhitespace();
+      if (!parseValue(member.value, depth + 1)) {
+        return false;
+      }
+      skipWhitespace();
+      if (consume("}")) {
+        return true;
+      }
+      if (!consume(",")) {
+        return false;
+      }
+    }
+  }
+
+  [[nodiscard]] bool parseArray(JsonValue& value, int depth) {
+    value.type = JsonValue::Type::Array;
+    ++position;
+    skipWhitespace();
+    if (consume("]")) {
+      return true;
+    }
+    while (true) {
+      skipWhitespace();
+      if (!parseValue(value.array.emplace_back(), depth + 1)) {
+        return false;
+      }
+      skipWhitespace();
+      if (consume("]")) {
+        return true;
+      }
+      if (!consume(",")) {
+        return false;
+      }
+    }
+  }
+
+  /**
+   * @brief Takes the number token if it follows the json grammar:
+   * -? (0 | [1-9][0-9]*) (.[0-9]+)? ([eE][+-]?[0-9]+)?
+   * Its value is checked when it is read into a variable.
+   **/
+  [[nodiscard]] bool parseNumber(JsonValue& value) {
+    const size_t begin = position;
+    static_cast<void>(consume("-"));
+    // A leading zero is the whole integer part.
+    if (!consume("0") && !skipDigits()) {
+      return false;
+    }
+    if (consume(".") && !skipDigits()) {
+      return false;
+    }
+    if (consume("e") || consume("E")) {
+      if (!consume("+")) {
+        static_cast<void>(consume("-"));
+      }
+      if (!skipDigits()) {
+        return false;
+      }
+    }
+    value.type = JsonValue::Type::Number;
+    value.text = text.substr(begin, position - begin);
+    return true;
+  }
+
+  /**
+   * @return false if there was no digit.
+   **/
+  [[nodiscard]] bool skipDigits() {
+    const size_t begin = position;
+    while (position < text.size() && text[position] >= '0' && text[position] <= '9') {
+      ++position;
+    }
+    return position != begin;
+  }
+
+  [[nodiscard]] bool parseString(std::string& out) {
+    ++position;  // opening quote
+    out.clear();
+    while (position < text.size()) {
+      const char c = text[position++];
+      if (c == '"') {
+        return true;
+      }
+      if (static_cast<unsigned char>(c) < 0x20) {
+        return false;
+      }
+      if (c != '\\') {
+        out.push_back(c);
+        continue;
+      }
+      if (position == text.size()) {
+        return false;
+      }
+      switch (text[position++]) {
+        case '"':
+          out.push_back('"');
+          break;
+        case '\\':
+          out.push_back('\\');
+          break;
+        case '/':
+          out.push_back('/');
+          break;
+        case 'b':
+          out.push_back('\b');
+          break;
+        case 'f':
+          out.push_back('\f');
+          break;
+        case 'n':
+          out.push_back('\n');
+          break;
+        case 'r':
+          out.push_back('\r');
+          break;
+        case 't':
+          out.push_back('\t');
+          break;
+        case 'u':
+          if (!parseUnicodeEscape(out)) {
+            return false;
+          }
+          break;
+        default:
+          return false;
+      }
+    }
+    return false;
+  }
+
+  /**
+   * @brief Decodes \\uXXXX (and a following low surrogate) into UTF-8.
+   **/
+  [[nodiscard]] bool parseUnicodeEscape(std::string& out) {
+    uint32_t code_point = 0;
+    if (!parseHex4(code_point)) {
+      return false;
+    }
+    if (code_point >= 0xD800 && code_point <= 0xDBFF) {
+      uint32_t low = 0;
+      if (!consume("\\u") || !parseHex4(low) || low < 0xDC00 || low > 0xDFFF) {
+        return false;
+      }
+      code_point = 0x10000 + ((code_point - 0xD800) << 10U) + (low - 0xDC00);
+    } else if (code_point >= 0xDC00 && code_point <= 0xDFFF) {
+      return false;
+    }
+    appendUtf8(code_point, out);
+    return true;
+  }
+
+  [[nodiscard]] bool parseHex4(uint32_t& value) {
+    if (text.size() - position < 4) {
+      return false;
+    }
+    const char* begin = text.data() + position;
+    const auto [end, error] = std::from_chars(begin, begin + 4, value, 16);
+    if (error != std::errc() || end != begin + 4) {
+      return false;
+    }
+    position += 4;
+    return true;
+  }
+
+  static void appendUtf8(uint32_t code_point, std::string& out) {
+    if (code_point < 0x80) {
+      out.push_back(static_cast<char>(code_point));
+    } else if (code_point < 0x800) {
+      out.push_back(static_cast<char>(0xC0 | (code_point >> 6U)));
+      out.push_back(static_cast<char>(0x80 | (code_point & 0x3FU)));
+    } else if (code_point < 0x10000) {
+      out.push_back(static_cast<char>(0xE0 | (code_point >> 12U)));
+      out.push_back(static_cast<char>(0x80 | ((code_point >> 6U) & 0x3FU)));
+      out.push_back(static_cast<char>(0x80 | (code_point & 0x3FU)));
+    } else {
+      out.push_back(static_cast<char>(0xF0 | (code_point >> 18U)));
+      out.push_back(static_cast<char>(0x80 | ((code_point >> 12U) & 0x3FU)));
+      out.push_back(static_cast<char>(0x80 | ((code_point >> 6U) & 0x3FU)));
+      out.push_back(static_cast<char>(0x80 | (code_point & 0x3FU)));
+    }
+  }
+
+  [[nodiscard]] bool consume(std::string_view token) {
+    if (text.substr(position, token.size()) != token) {
+      return false;
+    }
+    position += token.size();
+    return true;
+  }
+
+  void skipWhitespace() {
+    while (position < text.size() &&
+           (text[position] == ' ' || text[position] == '\t' || text[position] == '\n' ||
+            text[position] == '\r')) {
+      ++position;
+    }
+  }
+
+  std::string_view text;
+  size_t position = 0;
+};
+
+/**
+ * @brief Writes a JsonValue as indented json text.
+ **/
+class JsonPrinter {
+ public:
+  /**
+   * @brief Appends the value to out.
+   * @param value The value to print.
+   * @param out The text to append to.
+   * @param indent The indentation of the line the value starts in.
+   **/
+  static void print(const JsonValue& value, std::string& out, int indent = 0) {
+    switch (value.type) {
+      case JsonValue::Type::Null:
+        out += "null";
+        break;
+      case JsonValue::Type::Bool:
+        out += value.boolean ? "true" : "false";
+        break;
+      case JsonValue::Type::Number:
+        out += value.text;
+        break;
+      case JsonValue::Type::String:
+        printString(value.text, out);
+        break;
+      case JsonValue::Type::Array:
+        printArray(value, out, indent);
+        break;
+      case JsonValue::Type::Object:
+        printObject(value, out, indent);
+        break;
+    }
+  }
+
+ private:
+  static constexpr int INDENT = 2;
+
+  static void newLine(std::string& out, int indent) {
+    out.push_back('\n');
+    out.append(static_cast<size_t>(indent), ' ');
+  }
+
+  static void printArray(const JsonValue& value, std::string& out, int indent) {
+    if (value.array.empty()) {
+      out += "[]";
+      return;
+    }
+    // Arrays of scalars stay on one line.
+    const bool nested = value.array.front().type == JsonValue::Type::Array ||
+                        value.array.front().type == JsonValue::Type::Object;
+    out.push_back('[');
+    for (size_t i = 0; i < value.array.size(); ++i) {
+      if (i > 0) {
+        out.push_back(',');
+        if (!nested) {
+          out.push_back(' ');
+        }
+      }
+      if (nested) {
+        newLine(out, indent + INDENT);
+      }
+      print(value.array[i], out, indent + INDENT);
+    }
+    if (nested) {
+      newLine(out, indent);
+    }
+    out.push_back(']');
+  }
+
+  static void printObject(const JsonValue& value, std::string& out, int indent) {
+    if (value.object.empty()) {
+      out += "{}";
+      return;
+    }
+    out.push_back('{');
+    for (size_t i = 0; i < value.object.size(); ++i) {
+      if (i > 0) {
+        out.push_back(',');
+      }
+      newLine(out, indent + INDENT);
+      printString(value.object[i].name, out);
+      out += ": ";
+      print(value.object[i].value, out, indent + INDENT);
+    }
+    newLine(out, indent);
+    out.push_back('}');
+  }
+
+  static void printString(std::string_view text, std::string& out) {
+    constexpr std::string_view HEX = "0123456789abcdef";
+    out.push_back('"');
+    for (const char c : text) {
+      switch (c) {
+        case '"':
+          out += "\\\"";
+          break;
+        case '\\':
+          out += "\\\\";
+          break;
+        case '\n':
+          out += "\\n";
+          break;
+        case '\r':
+          out += "\\r";
+          break;
+        case '\t':
+          out += "\\t";
+          break;
+        default:
+          if (static_cast<unsigned char>(c) < 0x20) {
+            out += "\\u00";
+            out.push_back(HEX[static_cast<unsigned char>(c) >> 4U]);
+            out.push_back(HEX[static_cast<unsigned char>(c) & 0xFU]);
+          } else {
+            out.push_back(c);
+          }
+      }
+    }
+    out.push_back('"');
+  }
+};
+
+/**
+ * @brief Stores the variables as members of a json object. Arrays, containers
+ * and pairs are json arrays, a map is an array of [key, value] arrays (keys
+ * can be of any type). Numbers are written with std::to_chars, non finite
+ * floating point numbers as the strings "inf", "-inf" and "nan".
+ *
+ * Saving updates the members in place, so members the Settings class does not
+ * know are kept.
+ **/
+class JsonCodec {
+ public:
+  using Entry = JsonMember*;
+
+  /*!
+   * @brief Read the json file.
+   * @param source The file to read.
+   * @param load_mode How the file is read.
+   * @return DocumentStatus::Ok, NotFound or Empty if the file could be used.
+   */
+  [[nodiscard]] DocumentStatus loadFile(const std::filesystem::path& source, FileLoadMode load_mode) {
+    if (load_mode == FileLoadMode::MemoryMapped) {
+      const MappedFile mapped_file(source);
+      switch (mapped_file.status()) {
+        case MappedFile::Status::Ok:
+          return loadBuffer(std::span<const char>(mapped_file.data(), mapped_file.size()));
+        case MappedFile::Status::NotFound:
+          return DocumentStatus::NotFound;
+        case MappedFile::Status::CouldNotOpen:
+          return DocumentStatus::CouldNotOpen;
+        case MappedFile::Status::Empty:
+          return DocumentStatus::Empty;
+        case MappedFile::Status::NotMappable:
+          // fall back to reading the file.
+          break;
+      }
+    }
+    std::error_code error;
+    if (!std::filesystem::exists(source, error)) {
+      return DocumentStatus::NotFound;
+    }
+    std::ifstream file(source, std::ios::binary);
+    if (!file) {
+      return DocumentStatus::CouldNotOpen;
+    }
+    const std::string json((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    if (file.bad()) {
+      return DocumentStatus::ReadError;
+    }
+    return loadBuffer(json);
+  }
+
+  /*!
+   * @brief Parses the given json text.
+   * @param json The text, does not need to be null terminated.
+   * @return DocumentStatus::Ok, Empty or ParseError.
+   */
+  [[nodiscard]] DocumentStatus loadBuffer(std::span<const char> json) {
+    const std::string_view text(json.data(), json.size());
+    if (text.find_first_not_of(" \t\n\r") == std::string_view::npos) {
+      return DocumentStatus::Empty;
+    }
+    document = JsonValue{};
+    if (!JsonParser(text).parse(document) || document.type != JsonValue::Type::Object) {
+      error_text = "invalid json document";
+      document   = JsonValue{};
+      return DocumentStatus::ParseError;
+    }
+    error_text.clear();
+    return DocumentStatus::Ok;
+  }
+
+  /*!
+   * @brief Starts an empty document.
+   * @param root_name Unused, the json document is the object of the variables.
+   */
+  void clear(std::string_view root_name) {
+    static_cast<void>(root_name);
+    document      = JsonValue{};
+    document.type = JsonValue::Type::Object;
+  }
+
+  /*!
+   * @brief Writes the document into the given file.
+   * @return true on success.
+   */
+  [[nodiscard]] bool saveFile(const std::filesystem::path& file) {
+    std::string json;
+    JsonPrinter::print(document, json);
+    json.push_back('\n');
+    std::ofstream out(file, std::ios::binary | std::ios::trunc);
+    out.write(json.data(), static_cast<std::streamsize>(json.size()));
+    return static_cast<bool>(out);
+  }
+
+  [[nodiscard]] std::string errorText() const { return error_text; }
+
+  [[nodiscard]] Entry find(std::string_view name) {
+    for (JsonMember& member : document.object) {
+      if (member.name == name) {
+        return &member;
+      }
+    }
+    return nullptr;
+  }
+
+  [[nodiscard]] Entry firstEntry() {
+    return document.object.empty() ? nullptr : document.object.data();
+  }
+
+  [[nodiscard]] Entry nextEntry(Entry entry) {
+    ++entry;
+    return entry == document.object.data() + document.object.size() ? nullptr : entry;
+  }
+
+  [[nodiscard]] static std::string_view entryName(Entry entry) { return entry->name; }
+
+  [[nodiscard]] Entry appendEntry(std::string_view name) {
+    JsonMember& member = document.object.emplace_back();
+    member.name        = name;
+    return &member;
+  }
+
+  /*!
+   * @brief Hashes the value of the member.
+   * @param entry Valid handle of the member which stores the variable.
+   * @return The hash, independent of the name of the member.
+   */
+  [[nodiscard]] static size_t entryHash(const JsonMember* entry) { return valueHash(entry->value); }
+
+  /*!
+   * @brief Loads the stored value in to the variable.
+   * @param entry Valid handle of the member which stores the variable.
+   * @param values Pointer to the variable or begin of the array.
+   * @param size The size of the array (1 if no array).
+   * return CodecStatus showing if parsing was successfull.
+   */
+  template <class T>
+  [[nodiscard]] CodecStatus read(const JsonMember* entry, T* values, int size) {
+    const JsonValue& value = entry->value;
+    if (size > 1) {
+      if (value.type != JsonValue::Type::Array || value.array.size() != static_cast<size_t>(size)) {
+        return CodecStatus::Invalid;
+      }
+      for (int i = 0; i < size; ++i) {
+        const CodecStatus status = loadData(value.array[static_cast<size_t>(i)], values[i]);
+        if (status != CodecStatus::Ok) {
+          return status;
+        }
+      }
+      return CodecStatus::Ok;
+    }
+    return loadData(value, *values);
+  }
+
+  /*!
+   * @brief Stores the value of the variable into the member.
+   * @param entry Valid handle of the member which stores the variable.
+   * @param values Pointer to the variable or begin of the array.
+   * @param size The size of the array (1 if no array).
+   */
+  template <class T>
+  void write(JsonMember* entry, T* values, int size) {
+    JsonValue& value = entry->value;
+    if (size > 1) {
+      value      = JsonValue{};
+      value.type = JsonValue::Type::Array;
+      value.array.resize(static_cast<size_t>(size));
+      for (int i = 0; i < size; ++i) {
+        saveData(value.array[static_cast<size_t>(i)], values[i]);
+      }
+      return;
+    }
+    saveData(value, *values);
+  }
+
+ private:
+  [[nodiscard]] static size_t valueHash(const JsonValue& value) {
+    size_t hash = static_cast<size_t>(value.type);
+    hashCombine(hash, static_cast<size_t>(value.boolean));
+    hashCombine(hash, std::hash<std::string_view>{}(value.text));
+    for (const JsonValue& element : value.array) {
+      hashCombine(hash, valueHash(element));
+    }
+    for (const JsonMember& member : value.object) {
+      hashCombine(hash, std::hash<std::string_view>{}(member.name));
+      hashCombine(hash, valueHash(member.value));
+    }
+    return hash;
+  }
+
+  /// <Loading methodes>
+  /// <TYPE_SUPPORT> Define how your type is loaded from a JsonValue
+
+  [[nodiscard]] static CodecStatus loadData(const JsonValue& value, bool& bool_data) {
+    if (value.type == JsonValue::Type::Null) {
+      return CodecStatus::NoValue;
+    }
+    if (value.type != JsonValue::Type::Bool) {
+      return CodecStatus::Invalid;
+    }
+    bool_data = value.boolean;
+    return CodecStatus::Ok;
+  }
+
+  template <CharconvNumber T>
+  [[nodiscard]] static CodecStatus loadData(const JsonValue& value, T& number_data) {
+    if (value.type == JsonValue::Type::Null) {
+      return CodecStatus::NoValue;
+    }
+    if (value.type == JsonValue::Type::String) {
+      return loadNonFinite(value.text, number_data);
+    }
+    if (value.type != JsonValue::Type::Number) {
+      return CodecStatus::Invalid;
+    }
+    return parseNumber(value.text, number_data) ? CodecStatus::Ok : CodecStatus::Invalid;
+  }
+
+  /**
+   * @brief Strings hold the non finite floating point numbers, see
+   * saveData().
+   **/
+  template <CharconvNumber T>
+  [[nodiscard]] static CodecStatus loadNonFinite(std::string_view text, T& number_data) {
+    if constexpr (std::is_floating_point_v<T>) {
+      if (text == "inf") {
+        number_data = std::numeric_limits<T>::infinity();
+        return CodecStatus::Ok;
+      }
+      if (text == "-inf") {
+        number_data = -std::numeric_limits<T>::infinity();
+        return CodecStatus::Ok;
+      }
+      if (text == "nan") {
+        number_data = std::numeric_limits<T>::quiet_NaN();
+        return CodecStatus::Ok;
+      }
+    }
+    static_cast<void>(text);
+    static_cast<void>(number_data);
+    return CodecStatus::Invalid;
+  }
+
+  [[nodiscard]] static CodecStatus loadString(const JsonValue& value, const std::string*& string_data) {
+    if (value.type == JsonValue::Type::Null) {
+      return CodecStatus::NoValue;
+    }
+    if (value.type != JsonValue::Type::String) {
+      return CodecStatus::Invalid;
+    }
+    string_data = &value.text;
+    return CodecStatus::Ok;
+  }
+
+  [[nodiscard]] static CodecStatus loadData(const JsonValue& value, std::string& string_data) {
+    const std::string* text = nullptr;
+    const CodecStatus status = loadString(value, text);
+    if (status == CodecStatus::Ok) {
+      string_data = *text;
+    }
+    return status;
+  }
+
+  [[nodiscard]] static CodecStatus loadData(const JsonValue& value, std::wstring& wstring_data) {
+    const std::string* text = nullptr;
+    const CodecStatus status = loadString(value, text);
+    if (status == CodecStatus::Ok) {
+      wstring_data = castToWstring(*text);
+    }
+    return status;
+  }
+
+  [[nodiscard]] static CodecStatus loadData(const JsonValue& value, char& char_data) {
+    const std::string* text = nullptr;
+    const CodecStatus status = loadString(value, text);
+    if (status != CodecStatus::Ok) {
+      return status;
+    }
+    if (text->size() != 1) {
+      return CodecStatus::Invalid;
+    }
+    char_data = text->front();
+    return CodecStatus::Ok;
+  }
+
+  [[nodiscard]] static CodecStatus loadData(const JsonValue& value, wchar_t& wchar_data) {
+    const std::string* text = nullptr;
+    const CodecStatus status = loadString(value, text);
+    if (status != CodecStatus::Ok) {
+      return status;
+    }
+    const std::wstring wtext = castToWstring(*text);
+    if (wtext.size() != 1) {
+      return CodecStatus::Invalid;
+    }
+    wchar_data = wtext.front();
+    return CodecStatus::Ok;
+  }
+
+  template <class T1, class T2>
+  [[nodiscard]] static CodecStatus loadData(const JsonValue& value, std::pair<T1, T2>& pair_data) {
+    if (value.type != JsonValue::Type::Array || value.array.size() != 2) {
+      return CodecStatus::Invalid;
+    }
+    const CodecStatus status = loadData(value.array[0], pair_data.first);
+    if (status != CodecStatus::Ok) {
+      return status;
+    }
+    return loadData(value.array[1], pair_data.second);
+  }
+
+  /*!
+   * @brief Loads a json array into a vector like container.
+   */
+  template <class VectorContainer>
+  [[nodiscard]] static CodecStatus loadVectorData(const JsonValue& value, VectorContainer& container) {
+    if (value.type != JsonValue::Type::Array) {
+      return CodecStatus::Invalid;
+    }
+    container.resize(value.array.size());
+    auto element = value.array.begin();
+    for (auto& data : container) {
+      const CodecStatus status = loadData(*element++, data);
+      if (status != CodecStatus::Ok) {
+        return status;
+      }
+    }
+    return CodecStatus::Ok;
+  }
+
+  /*!
+   * @brief Loads a json array into a set like container. Map like containers
+   * use std::pair as Element.
+   */
+  template <class Element, class Container>
+  [[nodiscard]] static CodecStatus loadSetData(const JsonValue& value, Container& container) {
+    if (value.type != JsonValue::Type::Array) {
+      return CodecStatus::Invalid;
+    }
+    container.clear();
+    auto insertion_hint = container.begin();
+    for (const JsonValue& element : value.array) {
+      Element data;
+      const CodecStatus status = loadData(element, data);
+      if (status != CodecStatus::Ok) {
+        return status;
+      }
+      insertion_hint = container.insert(insertion_hint, std::move(data));
+    }
+    return CodecStatus::Ok;
+  }
+
+  template <class T>
+  [[nodiscard]] static CodecStatus loadData(const JsonValue& value, std::vector<T>& data) {
+    return loadVectorData(value, data);
+  }
+
+  template <class T>
+  [[nodiscard]] static CodecStatus loadData(const JsonValue& value, std::list<T>& data) {
+    return loadVectorData(value, data);
+  }
+
+  template <class T>
+  [[nodiscard]] static CodecStatus loadData(const JsonValue& value, std::set<T>& data) {
+    return loadSetData<T>(value, data);
+  }
+
+  template <class T>
+  [[nodiscard]] static CodecStatus loadData(const JsonValue& value, std::multiset<T>& data) {
+    return loadSetData<T>(value, data);
+  }
+
+  template <class T>
+  [[nodiscard]] static CodecStatus loadData(const JsonValue& value, std::unordered_set<T>& data) {
+    return loadSetData<T>(value, data);
+  }
+
+  template <class T1, class T2>
+  [[nodiscard]] static CodecStatus loadData(const JsonValue& value, std::map<T1, T2>& data) {
+    return loadSetData<std::pair<T1, T2>>(value, data);
+  }
+
+  template <class T1, class T2>
+  [[nodiscard]] static CodecStatus loadData(const JsonValue& value, std::multimap<T1, T2>& data) {
+    return loadSetData<std::pair<T1, T2>>(value, data);
+  }
+
+  template <class T1, class T2>
+  [[nodiscard]] static CodecStatus loadData(const JsonValue& value, std::unordered_map<T1, T2>& data) {
+    return loadSetData<std::pair<T1, T2>>(value, data);
+  }
+
+  template <class T1, class T2>
+  [[nodiscard]] static CodecStatus loadData(const JsonValue& value,
+                                            std::unordered_multimap<T1, T2>& data) {
+    return loadSetData<std::pair<T1, T2>>(value, data);
+  }
+
+  /// </Loading methodes>
+
+  /// <Saving methodes>
+  /// <TYPE_SUPPORT> Define how your type is stored in a JsonValue
+
+  static void setString(JsonValue& value, std::string text) {
+    value      = JsonValue{};
+    value.type = JsonValue::Type::String;
+    value.text = std::move(text);
+  }
+
+  static void saveData(JsonValue& value, const bool bool_data) {
+    value         = JsonValue{};
+    value.type    = JsonValue::Type::Bool;
+    value.boolean = bool_data;
+  }
+
+  template <CharconvNumber T>
+  static void saveData(JsonValue& value, const T number_data) {
+    if constexpr (std::is_floating_point_v<T>) {
+      if (!std::isfinite(number_data)) {
+        // json has no representation for these, parseNumber() reads them back.
+        setString(value, std::isnan(number_data) ? "nan" : (number_data > 0 ? "inf" : "-inf"));
+        return;
+      }
+    }
+    NumberBuffer buffer;
+    value      = JsonValue{};
+    value.type = JsonValue::Type::Number;
+    value.text = formatNumber(number_data, buffer);
+  }
+
+  static void saveData(JsonValue& value, const std::string& string_data) {
+    setString(value, string_data);
+  }
+
+  static void saveData(JsonValue& value, const std::wstring& wstring_data) {
+    setString(value, castFromWstring(wstring_data));
+  }
+
+  static void saveData(JsonValue& value, const char char_data) {
+    setString(value, std::string(1, char_data));
+  }
+
+  static void saveData(JsonValue& value, const wchar_t wchar_data) {
+    setString(value, castFromWstring(std::wstring(1, wchar_data)));
+  }
+
+  template <class T1, class T2>
+  static void saveData(JsonValue& value, const std::pair<T1, T2>& pair_data) {
+    value      = JsonValue{};
+    value.type = JsonValue::Type::Array;
+    value.array.resize(2);
+    saveData(value.array[0], pair_data.first);
+    saveData(value.array[1], pair_data.second);
+  }
+
+  /*!
+   * @brief Stores a container as json array, map elements as [key, value].
+   */
+  template <class Container>
+  static void saveContainer(JsonValue& value, const Container& container) {
+    value      = JsonValue{};
+    value.type = JsonValue::Type::Array;
+    value.array.resize(container.size());
+    auto element = value.array.begin();
+    for (const auto& data : container) {
+      saveData(*element++, data);
+    }
+  }
+
+  template <class T>
+  static void saveData(JsonValue& value, const std::vector<T>& data) {
+    saveContainer(value, data);
+  }
+
+  template <class T>
+  static void saveData(JsonValue& value, const std::list<T>& data) {
+    saveContainer(value, data);
+  }
+
+  template <class T>
+  static void saveData(JsonValue& value, const std::set<T>& data) {
+    saveContainer(value, data);
+  }
+
+  template <class T>
+  static void saveData(JsonValue& value, const std::multiset<T>& data) {
+    saveContainer(value, data);
+  }
+
+  template <class T>
+  static void saveData(JsonValue& value, const std::unordered_set<T>& data) {
+    saveContainer(value, data);
+  }
+
+  template <class T1, class T2>
+  static void saveData(JsonValue& value, const std::map<T1, T2>& data) {
+    saveContainer(value, data);
+  }
+
+  template <class T1, class T2>
+  static void saveData(JsonValue& value, const std::multimap<T1, T2>& data) {
+    saveContainer(value, data);
+  }
+
+  template <class T1, class T2>
+  static void saveData(JsonValue& value, const std::unordered_map<T1, T2>& data) {
+    saveContainer(value, data);
+  }
+
+  template <class T1, class T2>
+  static void saveData(JsonValue& value, const std::unordered_multimap<T1, T2>& data) {
+    saveContainer(value, data);
+  }
+
+  /// </Saving methodes>
+
+  JsonValue document;
+  std::string error_text;
+};
+
+}  // namespace util
@@ -0,0 +1,128 @@
+/**
+ * @file published.hpp
+ * @brief Contains the double buffer which lets threads read settings while they are reloaded.
+ *
+ * @date 16.10.2026
+ * @author Jakob Wandel
+ * @version 1.0
+ **/
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+
+namespace util {
+
+/**
+ * @brief Publishes immutable instances of a Settings class to reader threads
+ * (read copy update). A reload builds a new instance with the factory, which
+ * loads the file into the members of the new instance, and then replaces the
+ * published one. Readers keep the instance they got until they ask again, so
+ * they never see a half loaded value. The old instance is destroyed once the
+ * last reader dropped it.
+ *
+ * Readers use a Reader each (per thread): Reader::get() only loads an atomic
+ * version number as long as nothing was published, no lock and no reference
+ * counting on that path.
+ *
+ * @tparam SettingsT The class derived from Settings. Readers only get const
+ * access.
+ **/
+template <class SettingsT>
+class Published {
+ public:
+  // Creates a new instance, e.g. by calling the constructor with the source
+  // file. Throws to keep the published instance.
+  using Factory = std::function<std::unique_ptr<SettingsT>()>;
+
+  /**
+   * @brief Cached access of one reader thread.
+   **/
+  class Reader {
+   public:
+    explicit Reader(const Published& published_settings)
+        : published(&published_settings) {}
+
+    /**
+     * @return The published instance. Stays valid until the next get().
+     **/
+    [[nodiscard]] const SettingsT& get() {
+      const uint64_t version = published->version.load(std::memory_order_acquire);
+      if (version != cached_version) {
+        cached         = published->current();
+        cached_version = version;
+      }
+      return *cached;
+    }
+
+   private:
+    const Published* published;
+    std::shared_ptr<const SettingsT> cached;
+    // The versions start with 1, so the first get() fetches the instance.
+    uint64_t cached_version = 0;
+  };
+
+  /**
+   * @brief Creates and publishes the first instance. Throws if the factory
+   * throws or returns nullptr.
+   * @param settings_factory Creates the instances on reload().
+   **/
+  explicit Published(Factory settings_factory)
+      : factory(std::move(settings_factory)) {
+    reload();
+  }
+
+  /**
+   * @brief Creates a new instance with the factory and publishes it. Throws
+   * if the factory throws or returns nullptr, the published instance stays.
+   * Not to be called concurrently with itself or publish().
+   **/
+  void reload() { publish(factory()); }
+
+  /**
+   * @brief Publishes the given instance. Throws if it is nullptr.
+   * @param settings A new instance, no one else may keep a pointer to it.
+   **/
+  void publish(std::unique_ptr<SettingsT> settings) {
+    if (!settings) {
+      throw std::runtime_error("Published::publish: No instance to publish!");
+    }
+    std::shared_ptr<const SettingsT> next(std::move(settings));
+    {
+      const std::lock_guard<std::mutex> lock(mutex);
+      // The old instance is released outside the lock, if this was the last
+      // reference.
+      std::swap(instance, next);
+    }
+    version.fetch_add(1, std::memory_order_release);
+  }
+
+  /**
+   * @return The published instance. Takes a short lock, use a Reader on hot
+   * paths.
+   **/
+  [[nodiscard]] std::shared_ptr<const SettingsT> current() const {
+    const std::lock_guard<std::mutex> lock(mutex);
+    return instance;
+  }
+
+  /**
+   * @return A Reader for the calling thread.
+   **/
+  [[nodiscard]] Reader reader() const { return Reader(*this); }
+
+ private:
+  Factory factory;
+  mutable std::mutex mutex;
+  std::shared_ptr<const SettingsT> instance;
+  // Incremented after each publish, Readers compare it to their cache.
+  std::atomic<uint64_t> version{0};
+};
+
+}  // namespace util
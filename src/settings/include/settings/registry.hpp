@@ -0,0 +1,163 @@
+/**
+ * @file registry.hpp
+ * @brief Contains the FlatRegistry, a contiguous name -> value storage used by the Settings class to hold the registered member variables.
+ *
+ * @date 16.10.2026
+ * @author Jakob Wandel
+ * @version 1.0
+ **/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace util {
+
+/**
+ * @brief Stores named values contiguously in registration order. Names are
+ * resolved through an open addressing (linear probing) hash table holding only
+ * indices into the value vector, so a lookup with a std::string_view touches
+ * two flat arrays instead of chasing tree nodes.
+ *
+ * Iterators are invalidated by emplace(), like those of std::vector.
+ *
+ * @tparam Value The stored type, must be move constructible.
+ **/
+template <class Value>
+class FlatRegistry {
+ public:
+  using Entry          = std::pair<std::string, Value>;
+  using iterator       = typename std::vector<Entry>::iterator;
+  using const_iterator = typename std::vector<Entry>::const_iterator;
+
+  /**
+   * @brief Inserts a new entry if the name is not yet registered.
+   * @param name The unique name of the entry.
+   * @param value The value to be moved into the registry.
+   * @return Iterator to the entry with that name and true if it was inserted,
+   * false if the name already existed (value is not used then).
+   **/
+  std::pair<iterator, bool> emplace(std::string_view name, Value&& value) {
+    const size_t hash = hashName(name);
+    if (!slots.empty()) {
+      const size_t found = findIndex(name, hash);
+      if (found != NOT_FOUND) {
+        return {entries.begin() + static_cast<std::ptrdiff_t>(found), false};
+      }
+    }
+
+    if ((entries.size() + 1) * 2 > slots.size()) {
+      rehash(slots.empty() ? MIN_SLOTS : slots.size() * 2);
+    }
+    entries.emplace_back(std::string(name), std::move(value));
+    hashes.push_back(hash);
+    insertSlot(hash, static_cast<uint32_t>(entries.size()));
+    return {std::prev(entries.end()), true};
+  }
+
+  /**
+   * @brief Finds the entry with the given name.
+   * @param name The name of the entry.
+   * @return Iterator to the entry or end() if not registered.
+   **/
+  [[nodiscard]] iterator find(std::string_view name) {
+    if (slots.empty()) {
+      return entries.end();
+    }
+    const size_t found = findIndex(name, hashName(name));
+    return found == NOT_FOUND ? entries.end()
+                              : entries.begin() + static_cast<std::ptrdiff_t>(found);
+  }
+
+  [[nodiscard]] const_iterator find(std::string_view name) const {
+    return const_cast<FlatRegistry*>(this)->find(name);  // NOLINT(cppcoreguidelines-pro-type-const-cast) find does not modify
+  }
+
+  /**
+   * @brief Reserves space for the given number of entries, so that
+   * registering them does not reallocate or rehash.
+   * @param count The number of expected entries.
+   **/
+  void reserve(size_t count) {
+    entries.reserve(count);
+    hashes.reserve(count);
+    size_t needed = MIN_SLOTS;
+    while (needed < count * 2) {
+      needed *= 2;
+    }
+    if (needed > slots.size()) {
+      rehash(needed);
+    }
+  }
+
+  [[nodiscard]] iterator begin() { return entries.begin(); }
+  [[nodiscard]] iterator end() { return entries.end(); }
+  [[nodiscard]] const_iterator begin() const { return entries.begin(); }
+  [[nodiscard]] const_iterator end() const { return entries.end(); }
+  [[nodiscard]] size_t size() const { return entries.size(); }
+  [[nodiscard]] bool empty() const { return entries.empty(); }
+
+ private:
+  static constexpr size_t MIN_SLOTS = 16;
+  static constexpr size_t NOT_FOUND = static_cast<size_t>(-1);
+
+  [[nodiscard]] static size_t hashName(std::string_view name) {
+    return std::hash<std::string_view>{}(name);
+  }
+
+  /**
+   * @brief Probes the slots for the entry with the given name.
+   * @return The index into entries or NOT_FOUND.
+   **/
+  [[nodiscard]] size_t findIndex(std::string_view name, size_t hash) const {
+    const size_t mask = slots.size() - 1;
+    for (size_t slot = hash & mask;; slot = (slot + 1) & mask) {
+      const uint32_t stored = slots[slot];
+      if (stored == EMPTY_SLOT) {
+        return NOT_FOUND;
+      }
+      const size_t index = stored - 1;
+      if (hashes[index] == hash && entries[index].first == name) {
+        return index;
+      }
+    }
+  }
+
+  /**
+   * @brief Puts the index (+1, 0 marks an empty slot) into the first free slot.
+   **/
+  void insertSlot(size_t hash, uint32_t index_plus_one) {
+    const size_t mask = slots.size() - 1;
+    size_t slot       = hash & mask;
+    while (slots[slot] != EMPTY_SLOT) {
+      slot = (slot + 1) & mask;
+    }
+    slots[slot] = index_plus_one;
+  }
+
+  /**
+   * @brief Rebuilds the slot table with the given size (power of two).
+   **/
+  void rehash(size_t slot_count) {
+    slots.assign(slot_count, EMPTY_SLOT);
+    for (size_t i = 0; i < entries.size(); ++i) {
+      insertSlot(hashes[i], static_cast<uint32_t>(i + 1));
+    }
+  }
+
+  static constexpr uint32_t EMPTY_SLOT = 0;
+
+  std::vector<Entry> entries;
+  // hashes[i] is the hash of entries[i].first, so rehashing and probing does
+  // not need to touch the strings.
+  std::vector<size_t> hashes;
+  std::vector<uint32_t> slots;
+};
+
+}  // namespace util
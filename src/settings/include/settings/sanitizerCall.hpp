@@ -0,0 +1,158 @@
+/**
+ * @file sanitizerCall.hpp
+ * @brief Contains the type erased sanitizer call of a registered variable, stored inline without heap allocation.
+ *
+ * @date 16.10.2026
+ * @author Jakob Wandel
+ * @version 1.0
+ **/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace util {
+
+/**
+ * @brief Calls a sanitizer function void(*)(T&, ARGS...) with the variable
+ * and the constant arguments given to Settings::put(). The function pointer,
+ * the pointer to the variable and the arguments are stored in a buffer inside
+ * the object, only argument packs larger than INLINE_SIZE are allocated on
+ * the heap. Calls go through one function pointer, no virtual dispatch.
+ *
+ * Move only, like the std::unique_ptr it replaces.
+ **/
+class SanitizerCall {
+ public:
+  // Fits the function pointer, the pointer to the variable and four doubles.
+  static constexpr size_t INLINE_SIZE = 48;
+
+  SanitizerCall() = default;
+
+  /**
+   * @brief Binds the function to the variable and the arguments.
+   * @param function The sanitizer.
+   * @param value The variable, must outlive this object.
+   * @param args The arguments, copied.
+   **/
+  template <class T, class... ARGS>
+  SanitizerCall(void (*function)(T&, ARGS...), T& value, const std::type_identity_t<ARGS>&... args) {
+    using Call = BoundCall<T, ARGS...>;
+    if constexpr (storedInline<Call>()) {
+      ::new (static_cast<void*>(buffer.data())) Call{function, &value, std::tuple<ARGS...>(args...)};
+      operations = &INLINE_OPERATIONS<Call>;
+    } else {
+      ::new (static_cast<void*>(buffer.data())) Call*(new Call{function, &value, std::tuple<ARGS...>(args...)});
+      operations = &HEAP_OPERATIONS<Call>;
+    }
+  }
+
+  SanitizerCall(SanitizerCall&& other) noexcept { take(other); }
+
+  SanitizerCall& operator=(SanitizerCall&& other) noexcept {
+    if (this != &other) {
+      reset();
+      take(other);
+    }
+    return *this;
+  }
+
+  SanitizerCall(const SanitizerCall&)            = delete;
+  SanitizerCall& operator=(const SanitizerCall&) = delete;
+
+  ~SanitizerCall() { reset(); }
+
+  /**
+   * @brief Calls the sanitizer, does nothing if none is bound.
+   **/
+  void operator()() {
+    if (operations != nullptr) {
+      operations->call(buffer.data());
+    }
+  }
+
+  explicit operator bool() const { return operations != nullptr; }
+
+  /**
+   * @return true if a sanitizer is bound and stored without heap allocation.
+   **/
+  [[nodiscard]] bool isInline() const {
+    return operations != nullptr && operations->stored_inline;
+  }
+
+ private:
+  template <class T, class... ARGS>
+  struct BoundCall {
+    void (*function)(T&, ARGS...);
+    T* value;
+    std::tuple<ARGS...> args;
+
+    void operator()() {
+      std::apply([this](const ARGS&... arguments) { function(*value, arguments...); }, args);
+    }
+  };
+
+  // What the bound call needs, depending on its type and where it is stored.
+  struct Operations {
+    void (*call)(std::byte* storage);
+    // Moves the call from one buffer into the other and destroys the source.
+    void (*relocate)(std::byte* from, std::byte* to) noexcept;
+    void (*destroy)(std::byte* storage) noexcept;
+    bool stored_inline;
+  };
+
+  template <class Call>
+  [[nodiscard]] static constexpr bool storedInline() {
+    return sizeof(Call) <= INLINE_SIZE && alignof(Call) <= alignof(std::max_align_t) &&
+           std::is_nothrow_move_constructible_v<Call>;
+  }
+
+  // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast) The buffer holds the call (or the pointer to it).
+  template <class Call>
+  static constexpr Operations INLINE_OPERATIONS = {
+    [](std::byte* storage) { (*std::launder(reinterpret_cast<Call*>(storage)))(); },
+    [](std::byte* from, std::byte* to) noexcept {
+      Call* source = std::launder(reinterpret_cast<Call*>(from));
+      ::new (static_cast<void*>(to)) Call(std::move(*source));
+      source->~Call();
+    },
+    [](std::byte* storage) noexcept { std::launder(reinterpret_cast<Call*>(storage))->~Call(); },
+    true,
+  };
+
+  template <class Call>
+  static constexpr Operations HEAP_OPERATIONS = {
+    [](std::byte* storage) { (**std::launder(reinterpret_cast<Call**>(storage)))(); },
+    [](std::byte* from, std::byte* to) noexcept {
+      ::new (static_cast<void*>(to)) Call*(*std::launder(reinterpret_cast<Call**>(from)));
+    },
+    [](std::byte* storage) noexcept { delete *std::launder(reinterpret_cast<Call**>(storage)); },
+    false,
+  };
+  // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+
+  void take(SanitizerCall& other) noexcept {
+    if (other.operations != nullptr) {
+      other.operations->relocate(other.buffer.data(), buffer.data());
+      operations       = other.operations;
+      other.operations = nullptr;
+    }
+  }
+
+  void reset() noexcept {
+    if (operations != nullptr) {
+      operations->destroy(buffer.data());
+      operations = nullptr;
+    }
+  }
+
+  alignas(std::max_align_t) std::array<std::byte, INLINE_SIZE> buffer{};
+  const Operations* operations = nullptr;
+};
+
+}  // namespace util
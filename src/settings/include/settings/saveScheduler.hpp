@@ -0,0 +1,182 @@
+/**
+ * @file saveScheduler.hpp
+ * @brief Contains the scheduler which coalesces the save requests of one Settings instance.
+ *
+ * @date 16.10.2026
+ * @author Jakob Wandel
+ * @version 1.0
+ **/
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include <settings/saveWorker.hpp>
+
+namespace util {
+
+/**
+ * @brief Number of save requests and of the writes they resulted in.
+ **/
+struct SaveCounters {
+  size_t requested = 0;
+  size_t performed = 0;
+};
+
+/**
+ * @brief Coalesces save requests: a request replaces the pending write, which
+ * runs once no new request came in for the window, but at the latest
+ * max_latency after the first request it replaced. The writes are queued into
+ * the SaveWorker, so they keep their order with saveAsync() of other
+ * instances. Has its own thread to wait for the deadlines, started with the
+ * first request. On destruction the pending write is done. The worker is kept
+ * alive for that, even if the scheduler belongs to an object with static
+ * storage which is destroyed after the static of SaveWorker::instance().
+ **/
+class SaveScheduler {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  /**
+   * @param coalesce_window The time without new request after which the write starts.
+   * @param latency_limit The time after the first pending request after which
+   * the write starts, even if requests keep coming in.
+   **/
+  SaveScheduler(Clock::duration coalesce_window, Clock::duration latency_limit)
+      : window(coalesce_window),
+        max_latency(latency_limit),
+        worker(SaveWorker::instance()) {}
+
+  ~SaveScheduler() {
+    {
+      const std::lock_guard<std::mutex> lock(mutex);
+      stopping = true;
+    }
+    wakeup.notify_all();
+    if (thread.joinable()) {
+      thread.join();
+    }
+  }
+
+  SaveScheduler(const SaveScheduler&)            = delete;
+  SaveScheduler& operator=(const SaveScheduler&) = delete;
+  SaveScheduler(SaveScheduler&&)                 = delete;
+  SaveScheduler& operator=(SaveScheduler&&)      = delete;
+
+  /**
+   * @brief Replaces the pending write by the given one.
+   * @param write Writes the file, runs on the thread of the SaveWorker.
+   * Exceptions are rethrown by the next flush().
+   **/
+  void request(std::function<void()> write) {
+    {
+      const std::lock_guard<std::mutex> lock(mutex);
+      const Clock::time_point now = Clock::now();
+      if (!pending) {
+        first_request = now;
+      }
+      last_request = now;
+      pending      = std::move(write);
+      ++counters.requested;
+      if (!thread.joinable()) {
+        thread = std::thread([this] { run(); });
+      }
+    }
+    wakeup.notify_all();
+  }
+
+  /**
+   * @brief Starts the pending write without waiting for its deadline and
+   * waits until it and a write already running are done.
+   * Rethrows the exception of the first write which failed since the last
+   * flush().
+   **/
+  void flush() {
+    std::unique_lock<std::mutex> lock(mutex);
+    if (pending) {
+      flushing = true;
+      wakeup.notify_all();
+    }
+    wakeup.wait(lock, [this] { return !pending && !writing; });
+    if (error) {
+      std::exception_ptr failed = std::exchange(error, nullptr);
+      lock.unlock();
+      std::rethrow_exception(failed);
+    }
+  }
+
+  /**
+   * @return The number of requests and of the writes started for them.
+   **/
+  [[nodiscard]] SaveCounters saveCounters() const {
+    const std::lock_guard<std::mutex> lock(mutex);
+    return counters;
+  }
+
+ private:
+  void run() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+      wakeup.wait(lock, [this] { return stopping || pending; });
+      if (!pending) {
+        return;
+      }
+      if (!stopping && !flushing) {
+        const Clock::time_point deadline =
+          std::min(last_request + window, first_request + max_latency);
+        if (Clock::now() < deadline) {
+          // A new request moves the deadline, so check again after waking up.
+          wakeup.wait_until(lock, deadline);
+          continue;
+        }
+      }
+
+      std::function<void()> write = std::exchange(pending, nullptr);
+      flushing                    = false;
+      writing                     = true;
+      ++counters.performed;
+      lock.unlock();
+      std::future<void> done = worker->enqueue(std::move(write));
+      std::exception_ptr failed;
+      try {
+        done.get();
+      } catch (...) {
+        failed = std::current_exception();
+      }
+      lock.lock();
+      if (failed && !error) {
+        error = failed;
+      }
+      writing = false;
+      wakeup.notify_all();
+    }
+  }
+
+  const Clock::duration window;
+  const Clock::duration max_latency;
+  const std::shared_ptr<SaveWorker> worker;
+
+  mutable std::mutex mutex;
+  std::condition_variable wakeup;
+  std::function<void()> pending;
+  Clock::time_point first_request;
+  Clock::time_point last_request;
+  bool flushing = false;
+  bool writing  = false;
+  bool stopping = false;
+  std::exception_ptr error;
+  SaveCounters counters;
+  std::thread thread;
+};
+
+}  // namespace util
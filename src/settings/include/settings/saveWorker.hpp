@@ -0,0 +1,103 @@
+/**
+ * @file saveWorker.hpp
+ * @brief Contains the background thread which writes the files of Settings::saveAsync().
+ *
+ * @date 16.10.2026
+ * @author Jakob Wandel
+ * @version 1.0
+ **/
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace util {
+
+/**
+ * @brief One worker thread per process which runs the queued save jobs one
+ * after another in the order they were enqueued. The thread is started with
+ * the first job. On destruction the remaining jobs are finished before the
+ * thread is joined.
+ **/
+class SaveWorker {
+ public:
+  /**
+   * @return The worker of the process. Keep the pointer to use the worker
+   * while objects with static storage are destroyed: the static holding it
+   * may be destroyed first.
+   **/
+  [[nodiscard]] static std::shared_ptr<SaveWorker> instance() {
+    // The constructor is private.
+    static const std::shared_ptr<SaveWorker> worker(new SaveWorker());
+    return worker;
+  }
+
+  /**
+   * @brief Queues the job behind all jobs enqueued before.
+   * @param job Runs on the worker thread. Exceptions are passed to the future.
+   * @return Becomes ready once the job ran, get() rethrows its exception.
+   **/
+  [[nodiscard]] std::future<void> enqueue(std::function<void()> job) {
+    std::packaged_task<void()> task(std::move(job));
+    std::future<void> done = task.get_future();
+    {
+      const std::lock_guard<std::mutex> lock(mutex);
+      jobs.push_back(std::move(task));
+      if (!thread.joinable()) {
+        thread = std::thread([this] { run(); });
+      }
+    }
+    wakeup.notify_one();
+    return done;
+  }
+
+  ~SaveWorker() {
+    {
+      const std::lock_guard<std::mutex> lock(mutex);
+      stopping = true;
+    }
+    wakeup.notify_one();
+    if (thread.joinable()) {
+      thread.join();
+    }
+  }
+
+  SaveWorker(const SaveWorker&)            = delete;
+  SaveWorker& operator=(const SaveWorker&) = delete;
+  SaveWorker(SaveWorker&&)                 = delete;
+  SaveWorker& operator=(SaveWorker&&)      = delete;
+
+ private:
+  SaveWorker() = default;
+
+  void run() {
+    while (true) {
+      std::packaged_task<void()> task;
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        wakeup.wait(lock, [this] { return stopping || !jobs.empty(); });
+        if (jobs.empty()) {
+          return;
+        }
+        task = std::move(jobs.front());
+        jobs.pop_front();
+      }
+      task();
+    }
+  }
+
+  std::mutex mutex;
+  std::condition_variable wakeup;
+  std::deque<std::packaged_task<void()>> jobs;
+  bool stopping = false;
+  std::thread thread;
+};
+
+}  // namespace util
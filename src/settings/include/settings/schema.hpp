@@ -0,0 +1,264 @@
+/**
+ * @file schema.hpp
+ * @brief Contains the compile time schema of a Settings class: the names and member pointers of its variables, checked and hashed by the compiler.
+ *
+ * @date 16.10.2026
+ * @author Jakob Wandel
+ * @version 1.0
+ **/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <type_traits>
+
+namespace util {
+
+/**
+ * @brief A string literal usable as template parameter: Field<"name", ...>.
+ * @tparam N The size of the literal including the terminating null.
+ **/
+template <size_t N>
+struct FixedString {
+  // NOLINTNEXTLINE(google-explicit-constructor) Converts string literals in template arguments.
+  constexpr FixedString(const char (&text)[N]) { std::copy_n(text, N, value.begin()); }
+
+  [[nodiscard]] constexpr std::string_view view() const { return {value.data(), N - 1}; }
+
+  std::array<char, N> value{};
+};
+
+/**
+ * @brief One variable of a Schema: the name of its entry and the member it is
+ * loaded into. C arrays and std::array members are stored like put<T, N>().
+ * @tparam Name The name of the entry in the file, see Settings::put().
+ * @tparam Member Pointer to the member, e.g. &MySettings::value.
+ * @tparam IgnoreReadError See Settings::put(). Required like there: false
+ * throws on a corrupt entry.
+ **/
+template <FixedString Name, auto Member, bool IgnoreReadError>
+  requires std::is_member_object_pointer_v<decltype(Member)>
+struct Field {
+  static constexpr std::string_view name  = Name.view();
+  static constexpr auto member            = Member;
+  static constexpr bool ignore_read_error = IgnoreReadError;
+};
+
+namespace detail {
+
+/**
+ * @brief How a member is registered: the type of its elements and their
+ * number, like the T and N of Settings::put<T, N>().
+ **/
+template <class Member>
+struct FieldStorage {
+  using Element                = Member;
+  static constexpr size_t size = 1;
+  static Element* first(Member& member) { return &member; }
+};
+
+template <class T, size_t N>
+struct FieldStorage<T[N]> {
+  using Element                = T;
+  static constexpr size_t size = N;
+  static Element* first(T (&member)[N]) { return member; }
+};
+
+template <class T, size_t N>
+struct FieldStorage<std::array<T, N>> {
+  using Element                = T;
+  static constexpr size_t size = N;
+  static Element* first(std::array<T, N>& member) { return member.data(); }
+};
+
+/**
+ * @brief FNV-1a, evaluated by the compiler for the names of a Schema and at
+ * runtime for the names found in the file.
+ **/
+[[nodiscard]] constexpr uint64_t schemaHash(std::string_view name) {
+  uint64_t hash = 14695981039346656037ULL;
+  for (const char c : name) {
+    hash ^= static_cast<unsigned char>(c);
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+/**
+ * @brief Derives the slot hash of a name from its hash and the displacement
+ * of its bucket (splitmix64 finalizer).
+ **/
+[[nodiscard]] constexpr uint64_t schemaSlotHash(uint64_t hash, uint32_t displacement) {
+  uint64_t mixed = hash + 0x9e3779b97f4a7c15ULL * (static_cast<uint64_t>(displacement) + 1);
+  mixed          = (mixed ^ (mixed >> 30U)) * 0xbf58476d1ce4e5b9ULL;
+  mixed          = (mixed ^ (mixed >> 27U)) * 0x94d049bb133111ebULL;
+  return mixed ^ (mixed >> 31U);
+}
+
+// Sorts a copy, comparing each pair of names would exceed the constexpr
+// limits of the compilers for a few hundred names.
+template <size_t Count>
+[[nodiscard]] constexpr bool hasUniqueNames(std::array<std::string_view, Count> names) {
+  std::sort(names.begin(), names.end());
+  return std::adjacent_find(names.begin(), names.end()) == names.end();
+}
+
+[[nodiscard]] constexpr bool hasValidNames(std::span<const std::string_view> names) {
+  return std::ranges::none_of(names, [](std::string_view name) {
+    return name.empty() || name.find(' ') != std::string_view::npos;
+  });
+}
+
+/**
+ * @brief Perfect hash of the names (hash and displace): each name falls into
+ * a bucket, each bucket gets the first displacement which moves all its names
+ * into free slots. Buckets with more names are placed first.
+ * @tparam Count The number of names.
+ **/
+template <size_t Count>
+struct SchemaHash {
+  static constexpr size_t BUCKETS = Count == 0 ? 1 : Count;
+  // A power of two with at least two slots per name.
+  static constexpr size_t SLOTS              = std::bit_ceil(2 * BUCKETS);
+  static constexpr uint32_t EMPTY            = UINT32_MAX;
+  static constexpr uint32_t MAX_DISPLACEMENT = 1U << 20U;
+
+  std::array<uint32_t, BUCKETS> displacements{};
+  // The index of the name in each slot, or EMPTY.
+  std::array<uint32_t, SLOTS> slots{};
+  bool complete = false;
+
+  explicit constexpr SchemaHash(const std::array<std::string_view, Count>& names) {
+    slots.fill(EMPTY);
+    // Group the names by bucket (counting sort), members[begins[b], begins[b + 1]).
+    std::array<uint64_t, Count> hashes{};
+    std::array<size_t, BUCKETS + 1> begins{};
+    for (size_t i = 0; i < Count; ++i) {
+      hashes[i] = schemaHash(names[i]);
+      ++begins[hashes[i] % BUCKETS + 1];
+    }
+    for (size_t b = 0; b < BUCKETS; ++b) {
+      begins[b + 1] += begins[b];
+    }
+    std::array<uint32_t, Count> members{};
+    std::array<size_t, BUCKETS + 1> filled = begins;
+    for (size_t i = 0; i < Count; ++i) {
+      members[filled[hashes[i] % BUCKETS]++] = static_cast<uint32_t>(i);
+    }
+
+    std::array<size_t, BUCKETS> order{};
+    for (size_t b = 0; b < BUCKETS; ++b) {
+      order[b] = b;
+    }
+    std::sort(order.begin(), order.end(), [&begins](size_t a, size_t b) {
+      return begins[a + 1] - begins[a] > begins[b + 1] - begins[b];
+    });
+    for (const size_t bucket : order) {
+      const std::span<const uint32_t> bucket_members(members.data() + begins[bucket],
+                                                     begins[bucket + 1] - begins[bucket]);
+      if (!bucket_members.empty() && !place(hashes, bucket, bucket_members)) {
+        return;
+      }
+    }
+    complete = true;
+  }
+
+  /**
+   * @return The index of the only name which can have this hash.
+   **/
+  [[nodiscard]] constexpr uint32_t candidate(uint64_t hash) const {
+    const uint32_t displacement = displacements[hash % BUCKETS];
+    return slots[schemaSlotHash(hash, displacement) % SLOTS];
+  }
+
+ private:
+  /**
+   * @brief Finds the displacement of the bucket and fills its slots.
+   * @return false if there is none.
+   **/
+  constexpr bool place(const std::array<uint64_t, Count>& hashes,
+                       size_t bucket,
+                       std::span<const uint32_t> bucket_members) {
+    for (uint32_t displacement = 0; displacement < MAX_DISPLACEMENT; ++displacement) {
+      bool fits = true;
+      for (size_t i = 0; i < bucket_members.size() && fits; ++i) {
+        const size_t slot = schemaSlotHash(hashes[bucket_members[i]], displacement) % SLOTS;
+        fits              = slots[slot] == EMPTY;
+        // Two names of the bucket in one slot.
+        for (size_t j = 0; j < i && fits; ++j) {
+          fits = slot != schemaSlotHash(hashes[bucket_members[j]], displacement) % SLOTS;
+        }
+      }
+      if (fits) {
+        for (const uint32_t member : bucket_members) {
+          slots[schemaSlotHash(hashes[member], displacement) % SLOTS] = member;
+        }
+        displacements[bucket] = displacement;
+        return true;
+      }
+    }
+    return false;
+  }
+};
+
+}  // namespace detail
+
+/**
+ * @brief The variables of a Settings class, known to the compiler. Register
+ * them with Settings::registerSchema() instead of calling put() for each.
+ * Duplicate names, empty names and names with spaces do not compile.
+ * Looking up a name found in the file is a perfect hash computed by the
+ * compiler: one hash of the name, one slot and one string comparison.
+ *
+ * using Schema = util::Schema<util::Field<"count", &MySettings::count, true>,
+ *                             util::Field<"names", &MySettings::names, false>>;
+ *
+ * @tparam Fields The variables, see Field.
+ **/
+template <class... Fields>
+struct Schema {
+  static constexpr size_t size = sizeof...(Fields);
+  static constexpr std::array<std::string_view, size> names = {Fields::name...};
+
+  static_assert(detail::hasUniqueNames(names),
+                "Schema: Each member variable must be named uniquely!");
+  static_assert(detail::hasValidNames(names),
+                "Schema: Names must not be empty and must not contain the space character.");
+
+  /**
+   * @param name The name of an entry.
+   * @return The index of the Field with that name, size if there is none.
+   **/
+  [[nodiscard]] static constexpr size_t indexOf(std::string_view name) {
+    if constexpr (size == 0) {
+      return 0;
+    } else {
+      const uint32_t index = HASH.candidate(detail::schemaHash(name));
+      if (index == detail::SchemaHash<size>::EMPTY || names[index] != name) {
+        return size;
+      }
+      return index;
+    }
+  }
+
+  /**
+   * @brief Calls function.template operator()<Field>() for every Field in
+   * order.
+   **/
+  template <class Function>
+  static constexpr void forEachField(Function&& function) {
+    (function.template operator()<Fields>(), ...);
+  }
+
+ private:
+  static constexpr detail::SchemaHash<size> HASH{names};
+  static_assert(HASH.complete, "Schema: Could not build the perfect hash of the names.");
+};
+
+}  // namespace util
@@ -10,71 +10,221 @@
 #ifndef SETTINGS
 #define SETTINGS
 
-#include <tinyxml2.h>
-
+#include <algorithm>
+#include <array>
 #include <cassert>
-#include <codecvt>
+#include <chrono>
+#include <concepts>
 #include <deque>
 #include <filesystem>
+#include <fstream>
 #include <functional>
+#include <future>
 #include <iostream>
 #include <list>
-#include <locale>
 #include <map>
 #include <memory>
+#include <optional>
 #include <set>
+#include <span>
 #include <stdexcept>
+#include <string_view>
 #include <tuple>
 #include <unordered_map>
 #include <unordered_set>
-#include <utils/templates/variadicFunction.hpp>
+#include <settings/binary.hpp>
+#include <settings/codec.hpp>
+#include <settings/fileIo.hpp>
+#include <settings/fileWatcher.hpp>
+#include <settings/registry.hpp>
+#include <settings/saveScheduler.hpp>
+#include <settings/sanitizerCall.hpp>
+#include <settings/schema.hpp>
+#include <settings/saveWorker.hpp>
+#include <settings/sharedMemory.hpp>
+#include <settings/xmlCodec.hpp>
 #include <utils/filesystem/filesystem.hpp>
 #include <variant>
 #include <vector>
 
-// If you want to support a new type, you must define the load methode for it.
-// The save methode is setText (see savePrimitive()) from tinyxml2.h. You might
-// need to write your own if your Type is not supported. search for
-// <TYPE_SUPPORT> in this file to find all places which need new definitions.
+// The storage format is a codec (see codec.hpp), given as second template
+// parameter. XmlCodec (xmlCodec.hpp) is the default, JsonCodec (jsonCodec.hpp)
+// stores the same variables as json. If you want to support a new type, you
+// must define how the codec loads and saves it: search for <TYPE_SUPPORT> in
+// the codec to find all places which need new definitions.
 
 namespace util {
 
+/**
+ * @brief Result of Settings::reloadChangedFromFile().
+ **/
+struct ReloadResult {
+  // The variables which got a new value from the file.
+  std::vector<std::string> changed;
+  // Like the result of Settings::reloadAllFromFile().
+  std::vector<std::string> bad_variables;
+};
+
 // <TYPE_SUPPORT>
 // Base types: bool*, int*, unsigned int*, float*, double*, std::string*,
 // std::wstring (At the moment strings longer than 200 char will get croped!!)
 // (At the moment wstrings longer than 100 char will get croped!!)
 // StlContainer: All
+// VariantData is kept for compatibility only: put<T>() accepts every type the
+// codec supports, the variant does not need to list it.
 using namespace tinyxml2;
 template <typename VariantData =
-            std::variant<bool*, char*, wchar_t*, int*, unsigned int*, float*, double*, std::string*, std::wstring*>>
+            std::variant<bool*, char*, wchar_t*, int*, unsigned int*, float*, double*, std::string*, std::wstring*>,
+          SettingsCodec Codec = XmlCodec>
 class Settings {
 
+  // Handle of one stored variable in the document of the codec.
+  using Entry         = typename Codec::Entry;
+  using StreamPrinter = typename StreamPrinterOf<Codec>::type;
+
+  // The type specific code of a registered variable. Taken by put<T>(), so
+  // loading and saving an entry calls it directly instead of dispatching on
+  // a variant. values points to the variable or the begin of the array.
+  struct Operations {
+    CodecStatus (*read)(Codec& codec, Entry entry, void* values, int size);
+    void (*write)(Codec& codec, Entry entry, void* values, int size);
+    void (*encode)(BinaryWriter& writer, const void* values, int size);
+    // false if the bytes do not hold exactly the values, which are then left
+    // unchanged.
+    bool (*decode)(BinaryReader& reader, void* values, int size);
+    // Copies the values for saveAsync().
+    std::function<void(Codec&, Entry)> (*snapshot)(const void* values, int size);
+    // Only used with a StreamingCodec.
+    void (*print)(StreamPrinter& printer, const std::string& name, const void* values, int size);
+    // Stored with each binary entry, see binaryTypeTag().
+    uint32_t binary_type_tag;
+    // Fingerprint of the value stored in the entry, empty if it can not be
+    // read. The writer is reused for the encoding.
+    std::optional<size_t> (*stored_fingerprint)(Codec& codec, Entry entry, BinaryWriter& writer, int size);
+  };
+
+  /*!
+   * @brief Operations of the type T.
+   */
+  template <class T>
+  struct TypedOperations {
+    static CodecStatus read(Codec& codec, Entry entry, void* values, int size) {
+      return codec.read(entry, static_cast<T*>(values), size);
+    }
+
+    static void write(Codec& codec, Entry entry, void* values, int size) {
+      codec.write(entry, static_cast<T*>(values), size);
+    }
+
+    static void encode(BinaryWriter& writer, const void* values, int size) {
+      const T* typed_values = static_cast<const T*>(values);
+      for (int i = 0; i < size; ++i) {
+        writer.write(typed_values[i]);
+      }
+    }
+
+    static bool decode(BinaryReader& reader, void* values, int size) {
+      // Decoded into a copy, a truncated entry must not leave the variable
+      // half overwritten.
+      auto decoded = std::make_unique<T[]>(static_cast<size_t>(size));
+      for (int i = 0; i < size; ++i) {
+        if (!reader.read(decoded[static_cast<size_t>(i)])) {
+          return false;
+        }
+      }
+      if (!reader.done()) {
+        return false;
+      }
+      std::move(decoded.get(), decoded.get() + size, static_cast<T*>(values));
+      return true;
+    }
+
+    static std::function<void(Codec&, Entry)> snapshot(const void* values, int size) {
+      auto copy = std::make_shared<T[]>(static_cast<size_t>(size));
+      std::copy_n(static_cast<const T*>(values), size, copy.get());
+      return [copy, size](Codec& codec, Entry entry) { codec.write(entry, copy.get(), size); };
+    }
+
+    static void print(StreamPrinter& printer, const std::string& name, const void* values, int size) {
+      if constexpr (StreamingCodec<Codec>) {
+        printer.write(name, static_cast<const T*>(values), size);
+      }
+    }
+
+    static std::optional<size_t> storedFingerprint(Codec& codec, Entry entry, BinaryWriter& writer, int size) {
+      auto stored_values = std::make_unique<T[]>(static_cast<size_t>(size));
+      if (codec.read(entry, stored_values.get(), size) != CodecStatus::Ok) {
+        return std::nullopt;
+      }
+      writer.clear();
+      encode(writer, stored_values.get(), size);
+      return hashOf(writer);
+    }
+
+    static constexpr Operations TABLE = {
+      &read, &write, &encode, &decode, &snapshot, &print, binaryTypeTag<T>(), &storedFingerprint};
+  };
+
   struct Data {
-    Data(const VariantData& d, int s)
-        : data(d),
-          size(s) {}
-    VariantData data;
+    template <class T>
+    Data(T* value, int s)
+        : values(value),
+          size(s),
+          operations(&TypedOperations<T>::TABLE) {}
+    // The variable or the begin of the array.
+    void* values;
     int size;
+    const Operations* operations;
 
-    std::unique_ptr<VirtualCall> sanitizeFunction_ = nullptr;
+    // Stored inline, see SanitizerCall.
+    SanitizerCall sanitizeFunction_;
+
+    // Set while walking the document once in reload/save, to find the entries the
+    // file did not contain.
+    bool found_in_document = false;
+
+    // Hash of the binary encoding (see binary.hpp) of the value the document
+    // holds for this variable, taken when saving it or by save() from the
+    // entry. save() skips the variable while its value still has this
+    // fingerprint. Empty if unknown.
+    std::optional<size_t> fingerprint;
+
+    // Set while the entry in the document holds the value the variable was
+    // last loaded from or saved into. Loading hashes nothing: save() takes
+    // the fingerprint from the entry and reloadChangedFromFile() hashes the
+    // entry before replacing the document, only if they are called.
+    bool entry_in_sync = false;
+
+    // Lazy loading: the document has an entry for the variable, but it was
+    // not loaded yet (see materialize()).
+    bool load_pending = false;
+    // Given to put(), used when the variable is materialized.
+    bool ignore_read_error = false;
 
     /*!
      * @brief Will call the function provided in the member variable
      * sanitizeFunction_.
      */
     void sanitize() {
-      if (sanitizeFunction_) {
-        sanitizeFunction_->call();
-      }
+      sanitizeFunction_();
     }
   };
 
-  using Datamap   = typename std::map<std::string, Data>;
-  using Datapair  = typename std::pair<std::string, Data>;
-  using DatamapIt = typename std::map<std::string, Data>::iterator;
+  // Flat storage with hashed name lookup. Entries are pairs (name, Data) like
+  // in a std::map, but stored contiguously in registration order.
+  using Datamap   = FlatRegistry<Data>;
+  using Datapair  = typename Datamap::Entry;
+  using DatamapIt = typename Datamap::iterator;
+
+  // Copy of the value of one variable, taken by saveAsync().
+  struct SnapshotEntry {
+    std::string name;
+    // Writes the copied value into the given entry of the codec.
+    std::function<void(Codec&, Entry)> write;
+  };
 
  public:
-  Settings() { [[maybe_unused]] XMLError error = loadFile(); }
+  Settings() { [[maybe_unused]] const DocumentStatus status = loadFile(); }
 
  protected:
   /*!
@@ -84,7 +234,19 @@ class Settings {
    */
   Settings(const std::filesystem::path& source_file)
       : source(source_file) {
-    [[maybe_unused]] XMLError error = loadFile();
+    [[maybe_unused]] const DocumentStatus status = loadFile();
+  }
+
+  /*!
+   * @brief Constructor needs the path to the source file.
+   * The file does not need to exist.
+   * @param source_file The file and path from where to load the data.
+   * @param load_mode How the file is read, now and on every reload.
+   */
+  Settings(const std::filesystem::path& source_file, FileLoadMode load_mode)
+      : source(source_file),
+        file_load_mode(load_mode) {
+    [[maybe_unused]] const DocumentStatus status = loadFile();
   }
 
   /*!
@@ -92,8 +254,20 @@ class Settings {
    * @param xml A pointer to the cache begin
    * @param bytes the number of bytes in the cache
    */
-  Settings(const char* xml, size_t bytes) {
-    [[maybe_unused]] XMLError error = loadFromCache(xml, bytes);
+  Settings(const char* xml, size_t bytes)
+      : Settings(std::span<const char>(xml, bytes)) {}
+
+  /*!
+   * @brief Constructor load from a caller owned buffer (e.g. shared memory).
+   * The buffer is only read during the constructor, afterwards it can be
+   * released or reused. Only accepts a std::span, so that strings passed to a
+   * constructor keep selecting the file constructor.
+   * @param xml The xml text, does not need to be null terminated.
+   */
+  template <class Buffer>
+    requires std::same_as<Buffer, std::span<const char>>
+  explicit Settings(Buffer xml) {
+    [[maybe_unused]] const DocumentStatus status = loadFromCache(xml);
   }
 
   /*!
@@ -114,10 +288,20 @@ class Settings {
     const auto res = data.emplace(name, Data(value, N));
 
     if (!loadIf(name, ignore_read_error)) {
-      save(nullptr, res.first);
+      save(Entry{}, res.first);
     }
   }
 
+  /*!
+   * @brief Enables lazy loading for the variables registered afterwards:
+   * put() only checks if the document has an entry for the variable, the
+   * value is loaded (and sanitized) by materialize() or materializeAll().
+   * Saving and the reload functions materialize the variables they need.
+   * Call it in the constructor of your child class before put().
+   * @param lazy true to load lazily.
+   */
+  void setLazyLoading(bool lazy) { lazy_loading = lazy; }
+
   /*!
    * @brief Registers a membervariable to be saved in to xml format.
    * This should be done
@@ -143,12 +327,66 @@ class Settings {
     const std::pair<DatamapIt, bool> res = data.emplace(name, Data(value, N));
 
     res.first->second.sanitizeFunction_ =
-      std::make_unique<VariadicFunction<T&, ARGS...>>(
-        sanitizeVariableFunction, *value, args...);
+      SanitizerCall(sanitizeVariableFunction, *value, args...);
 
     res.first->second.sanitize();
     if (!loadIf(name, ignore_read_error)) {
-      save(nullptr, res.first);
+      save(Entry{}, res.first);
+    }
+  }
+
+  /*!
+   * @brief Registers all member variables of a Schema (see schema.hpp), like
+   * calling put() for each Field in order. The names are checked by the
+   * compiler, the document is walked once and each entry is matched to its
+   * Field by the perfect hash of the Schema instead of a search by name.
+   * This should be done in the constructor of your child class.
+   * This method can throw an exception.
+   * SchemaT The Schema of the child class.
+   * @param self The child class, this.
+   */
+  template <class SchemaT, class Derived>
+  void registerSchema(Derived* self) {
+    std::array<size_t, SchemaT::size> positions{};
+    data.reserve(data.size() + SchemaT::size);
+    size_t index = 0;
+    SchemaT::forEachField([this, self, &positions, &index]<class FieldT>() {
+      auto& member  = self->*FieldT::member;
+      using Storage = detail::FieldStorage<std::remove_reference_t<decltype(member)>>;
+      const std::pair<DatamapIt, bool> res =
+        data.emplace(FieldT::name, Data(Storage::first(member), static_cast<int>(Storage::size)));
+      assert(
+        "Settings::registerSchema: Each member variable must be named uniquely! "
+        "A Field has the name of a variable given to put()." &&
+        res.second);
+      res.first->second.ignore_read_error = FieldT::ignore_read_error;
+      positions[index++] = static_cast<size_t>(res.first - data.begin());
+    });
+
+    std::array<bool, SchemaT::size> found{};
+    for (Entry entry = codec.firstEntry(); entry != Entry{}; entry = codec.nextEntry(entry)) {
+      const size_t field = SchemaT::indexOf(std::string_view(Codec::entryName(entry)));
+      // Not in the schema, or a duplicate (the first one wins).
+      if (field == SchemaT::size || found[field]) {
+        continue;
+      }
+      found[field]       = true;
+      const DatamapIt it = data.begin() + static_cast<std::ptrdiff_t>(positions[field]);
+      if (lazy_loading) {
+        it->second.load_pending = true;
+        continue;
+      }
+      const CodecStatus status = load(entry, it);
+      if (status == CodecStatus::Invalid && !it->second.ignore_read_error) {
+        throw std::runtime_error(class_name + "::registerSchema: The file " +
+                                 source.string() + "had an entry " + it->first +
+                                 " But could not be parsed.");
+      }
+    }
+    for (size_t field = 0; field < SchemaT::size; ++field) {
+      if (!found[field]) {
+        save(Entry{}, data.begin() + static_cast<std::ptrdiff_t>(positions[field]));
+      }
     }
   }
 
@@ -183,45 +421,153 @@ class Settings {
    * @return a vector of all variables, which could not be read. Possible reasons: File does not exist, File did not contain the variable. File did contain the variable, but the variable could not be parsed.
    */
   std::vector<std::string> reloadAllFromCache(const char* xml, size_t bytes) {
-    return checkVariablesAfterReload(loadFromCache(xml, bytes));
+    return reloadAllFromCache(std::span<const char>(xml, bytes));
+  }
+
+  /*!
+   * @brief Writes the values into all member variables found in the given
+   * buffer. The buffer is only read during the call (it is not referenced
+   * afterwards), so it can be released or reused as soon as this returns.
+   * Accepts everything convertible to a std::span<const char> like
+   * std::string_view, std::string or std::vector<char>.
+   * @param xml The xml text, does not need to be null terminated.
+   * @return a vector of all variables, which could not be read. Possible reasons: The buffer did not contain the variable. The buffer did contain the variable, but the variable could not be parsed.
+   */
+  std::vector<std::string> reloadAllFromCache(std::span<const char> xml) {
+    return checkVariablesAfterReload(loadFromCache(xml));
   }
 
   /*!
    * @brief Checks all managed variables after a reload.
    * @return a vector of all variables, which could not be read. Possible reasons: File does not exist, File did not contain the variable. File did contain the variable, but the variable could not be parsed.
    */
-  std::vector<std::string> checkVariablesAfterReload(XMLError error) {
+  std::vector<std::string> checkVariablesAfterReload(DocumentStatus status) {
     std::vector<std::string> bad_variables{};
-    if (error != XMLError::XML_SUCCESS) {
+    if (status != DocumentStatus::Ok) {
       bad_variables.reserve(data.size());
       for (DatamapIt it = data.begin(); it != data.end(); ++it) {
         bad_variables.push_back(it->first);
       }
       return bad_variables;
     }
-    // Iterate through xml and find in map (is faster than other way round).
-    // same as in save() ->  FirstChildElement() does not return first element
-    /*
-    for (XMLElement* element = settings->FirstChildElement(); element !=
-      nullptr; element = element->NextSiblingElement()) { const std::string
-      name = element->Name(); DatamapIt settings_data_it = data.find(name);
-
-       assert(("Settings::loadAll: Did not found requested " + name).c_str()
-       && settings_data_it != data.end());
-
-        load(element, settings_data_it);
+    // Walk the stored entries once and resolve each to its variable, instead
+    // of searching the document for every registered name.
+    resetFoundInDocument();
+    for (Entry entry = codec.firstEntry(); entry != Entry{}; entry = codec.nextEntry(entry)) {
+      const DatamapIt it = findUnvisited(entry);
+      if (it == data.end()) {
+        continue;
       }
-      */
+      if (load(entry, it) != CodecStatus::Ok) {
+        bad_variables.push_back(it->first);
+      }
+    }
 
     for (DatamapIt it = data.begin(); it != data.end(); ++it) {
-      XMLElement* element = settings->FirstChildElement(it->first.c_str());
-      if (element == nullptr) {
+      if (!it->second.found_in_document) {
         bad_variables.push_back(it->first);
+      }
+    }
+    return bad_variables;
+  }
+
+  /*!
+   * @brief Like reloadAllFromFile(), but only loads and sanitizes the
+   * variables whose entry in the file changed since it was last loaded or
+   * saved (compared by a hash of the stored text). Variables changed in
+   * memory but not in the file keep their value. Throws if parsing error
+   * occured.
+   * @return The variables which were loaded and the variables which could not be read (see reloadAllFromFile()).
+   */
+  ReloadResult reloadChangedFromFile() {
+    // Hash the entries of the variables in sync with the document before
+    // loadFile() replaces it. The fingerprints of skipped variables stay
+    // valid, the new document holds the same entry. loadFile() resets them.
+    std::vector<std::optional<size_t>> entry_hashes(data.size());
+    std::vector<std::optional<size_t>> fingerprints;
+    fingerprints.reserve(data.size());
+    resetFoundInDocument();
+    for (Entry entry = codec.firstEntry(); entry != Entry{}; entry = codec.nextEntry(entry)) {
+      const DatamapIt it = findUnvisited(entry);
+      if (it != data.end() && it->second.entry_in_sync) {
+        entry_hashes[static_cast<size_t>(it - data.begin())] = Codec::entryHash(entry);
+      }
+    }
+    for (const auto& [name, entry] : data) {
+      fingerprints.push_back(entry.fingerprint);
+    }
+
+    ReloadResult result{};
+    const DocumentStatus status = loadFile();
+    if (status != DocumentStatus::Ok) {
+      result.bad_variables.reserve(data.size());
+      for (const auto& [name, entry] : data) {
+        result.bad_variables.push_back(name);
+      }
+      return result;
+    }
+
+    resetFoundInDocument();
+    for (Entry entry = codec.firstEntry(); entry != Entry{}; entry = codec.nextEntry(entry)) {
+      const DatamapIt it = findUnvisited(entry);
+      if (it == data.end()) {
         continue;
       }
+      const size_t index = static_cast<size_t>(it - data.begin());
+      if (entry_hashes[index].has_value() && *entry_hashes[index] == Codec::entryHash(entry)) {
+        it->second.fingerprint   = fingerprints[index];
+        it->second.entry_in_sync = true;
+        continue;
+      }
+      if (load(entry, it) == CodecStatus::Ok) {
+        result.changed.push_back(it->first);
+      } else {
+        result.bad_variables.push_back(it->first);
+      }
+    }
 
-      const XMLError errorLoad = load(element, it);
-      if (errorLoad != XMLError::XML_SUCCESS) {
+    for (const auto& [name, entry] : data) {
+      if (!entry.found_in_document) {
+        result.bad_variables.push_back(name);
+      }
+    }
+    return result;
+  }
+
+  /*!
+   * @brief Like reloadAllFromFile(), but without building the document of
+   * the whole file: each entry is parsed on its own and converted into its
+   * variable right away, so only the document of one entry exists at a time
+   * (see BasicXmlCodec::loadStreaming()). The text of the file is still held
+   * as a whole, mapped or read if it can not be mapped. Only the entries of unknown
+   * variables, comments and the declaration are kept in the document, so the
+   * next save() writes all variables. Throws if parsing error occured.
+   * @return a vector of all variables, which could not be read. Possible reasons: File does not exist, File did not contain the variable. File did contain the variable, but the variable could not be parsed.
+   */
+  std::vector<std::string> reloadAllStreaming()
+    requires StreamingCodec<Codec>
+  {
+    std::vector<std::string> bad_variables{};
+    resetFoundInDocument();
+    DocumentStatus status = DocumentStatus::NotFound;
+    if (!source.empty()) {
+      status = codec.loadStreaming(
+        source,
+        [this](std::string_view name) { return findUnvisited(name) != data.end(); },
+        [this, &bad_variables](Entry entry) {
+          const DatamapIt it = data.find(std::string_view(Codec::entryName(entry)));
+          if (load(entry, it) != CodecStatus::Ok) {
+            bad_variables.push_back(it->first);
+          }
+        });
+    }
+    // Resets the fingerprints: the document only holds empty elements for
+    // the loaded variables.
+    if (prepareDocumentAfterLoad(status) != DocumentStatus::Ok) {
+      return checkVariablesAfterReload(status);
+    }
+    for (DatamapIt it = data.begin(); it != data.end(); ++it) {
+      if (!it->second.found_in_document) {
         bad_variables.push_back(it->first);
       }
     }
@@ -238,880 +584,853 @@ class Settings {
     reloadAllFromFile();
   }
 
-  void reloadAffFromCache(const char* xml, size_t nBytes) {}
-
   /*!
-   * @brief Writes all values of registered members into xml file.
-   * Throws if parsing error occured or file could not be written.
+   * @brief Misspelled alias of reloadAllFromCache(), kept for compatibility.
    */
-  void save() {
-    // does not work for a reason:
-    // goes through each xml element and search in map. But FirstChildElement()
-    // seems not to give always first element...
-    /*
-    for (XMLElement* element = settings->FirstChildElement(); element !=
-       nullptr; element = element->NextSiblingElement()) { const std::string
-       name = element->Name(); DatamapIt settings_data_it = data.find(name);
+  [[deprecated("use reloadAllFromCache()")]] void reloadAffFromCache(const char* xml, size_t nBytes) {
+    reloadAllFromCache(xml, nBytes);
+  }
 
-          assert(("Settings::save: Did not found requested " + name).c_str()
-       && settings_data_it != data.end());
+  /*!
+   * @brief Sets how the source file is read on the next reload.
+   * @param load_mode FileLoadMode::MemoryMapped to parse directly from a
+   * read-only mapping of the file, FileLoadMode::Buffered to read it into a
+   * buffer first.
+   */
+  void setFileLoadMode(FileLoadMode load_mode) { file_load_mode = load_mode; }
 
-       save(element, settings_data_it);
-    }
-    */
+  /*!
+   * @brief Sets how save() and saveBinary(path) write their file.
+   * @param durability SaveDurability::Direct to overwrite the file in place,
+   * one of the atomic levels to write a temporary file and rename it over the
+   * file, with or without fsync (see fileIo.hpp).
+   */
+  void setSaveDurability(SaveDurability durability) { save_durability = durability; }
 
-    // goes through map and searches for the name in xml, which is probably way
-    // slower.
+  /*!
+   * @brief Writes all values of registered members into xml file. Only the
+   * variables which changed since they were last loaded or saved are
+   * sanitized and written into the document, the others keep their entry.
+   * Throws if parsing error occured or file could not be written.
+   * @return The names of the variables which were written into the document.
+   */
+  std::vector<std::string> save() {
     if (source.empty()) {
       throw std::runtime_error(class_name +
                                "::save: You did not set a file name!");
     }
 
+    std::vector<std::string> written{};
+    // Update the changed entries already in the document in a single pass.
+    // The entries stay where they are, so the walk is not disturbed.
+    resetFoundInDocument();
+    for (Entry entry = codec.firstEntry(); entry != Entry{}; entry = codec.nextEntry(entry)) {
+      const DatamapIt it = findUnvisited(entry);
+      // Variables which were not loaded yet still have the value of the entry.
+      if (it != data.end() && !it->second.load_pending && isChanged(entry, it->second)) {
+        save(entry, it);
+        written.push_back(it->first);
+      }
+    }
+
+    // Variables which are not yet in the document get appended.
     for (DatamapIt it = data.begin(); it != data.end(); ++it) {
-      XMLElement* element = settings->FirstChildElement(it->first.c_str());
-      // its of if element is a nullptr, in that case save(element, it) will create the element.
-      save(element, it);
+      if (!it->second.found_in_document) {
+        it->second.load_pending = false;
+        save(Entry{}, it);
+        written.push_back(it->first);
+      }
     }
 
-    XMLError error = settingsDocument.SaveFile(source.string().c_str());
-    if (error != XMLError::XML_SUCCESS) {
+    const FileWatcher::OwnWrite own_write(source_watcher.get());
+    const bool saved = writeFile(source, save_durability, [this](const std::filesystem::path& file) {
+      return codec.saveFile(file);
+    });
+    if (!saved) {
       throw std::runtime_error(class_name + "::save: The file " +
                                source.string() + "could not be written.");
     }
+    return written;
   }
 
   /*!
-   * @brief Writes all values of registered members into given file.
-   * Throws if parsing error occured or file could not be written.
-   * @param new_source The file and path to write into.
-   */
-  void save(const std::filesystem::path& new_source) {
-    source = new_source;
-    save();
-  }
-
-  /*!
-   * @brief Moves the xml file storing the data to the given destination.
-   * @return true if the move was sucessfull.
+   * @brief Like save(), but the values are printed directly into the text of
+   * the file instead of being written into the document first, so no nodes
+   * are created for the elements of containers. The file looks the same as
+   * after save(). Entries of unregistered variables and variables which were
+   * not materialized yet are copied from the document, which stays unchanged.
+   * All registered variables are sanitized and printed. Only for codecs
+   * supporting it (see StreamingCodec).
+   * Throws if no file name was set or the file could not be written.
    */
-  bool moveFile(const std::filesystem::path& new_file) {
-    if (std::filesystem::exists(new_file)) {
-      return false;
+  void saveStreaming()
+    requires StreamingCodec<Codec>
+  {
+    if (source.empty()) {
+      throw std::runtime_error(class_name +
+                               "::saveStreaming: You did not set a file name!");
     }
-    const std::filesystem::path old_file(source);
 
-    if (std::filesystem::exists(old_file)) {
-      // copy old to new
-      if (!std::filesystem::copy_file(old_file, new_file)) {
-        return false;
+    typename Codec::StreamPrinter printer;
+    codec.printStreaming(printer, [this](typename Codec::StreamPrinter& entries) {
+      resetFoundInDocument();
+      for (Entry entry = codec.firstEntry(); entry != Entry{}; entry = codec.nextEntry(entry)) {
+        const DatamapIt it = findUnvisited(entry);
+        if (it == data.end() || it->second.load_pending) {
+          entries.copy(entry);
+        } else {
+          print(entries, it);
+        }
       }
-      // delete old
-      if (!std::filesystem::remove(old_file)) {
-        if (!std::filesystem::remove(new_file)) {
-          // I cant even remove the file I just created??
-          throw std::runtime_error(
-            class_name + "::constructor: I was able to copy from (old) " +
-            old_file.string() + " to (new) " + new_file.string() +
-            " but I was not able to delete the old file. I was not able to "
-            "delete the newly created copy either. This smells like a "
-            "corrupt file system. Make sure to backup your data!");
+      for (DatamapIt it = data.begin(); it != data.end(); ++it) {
+        if (!it->second.found_in_document) {
+          print(entries, it);
         }
-        return false;
       }
+    });
+
+    const std::string_view text = printer.text();
+    const FileWatcher::OwnWrite own_write(source_watcher.get());
+    const bool saved = writeFile(source, save_durability, [&text](const std::filesystem::path& file) {
+      std::ofstream out(file, std::ios::binary | std::ios::trunc);
+      out.write(text.data(), static_cast<std::streamsize>(text.size()));
+      return static_cast<bool>(out);
+    });
+    if (!saved) {
+      throw std::runtime_error(class_name + "::saveStreaming: The file " +
+                               source.string() + "could not be written.");
     }
-    source = new_file;
-
-    return true;
+    // The document still holds the old values, the next save() has to
+    // rewrite the entries and they do not match the file anymore.
+    markAllChanged();
   }
 
   /*!
-   * @brief Deletes the xml file which stores the data. If save() is called,
-   * The file will created again.
-   * @return true if file could be deleted or did not exist in the first place.
-   * Return false if file still exists.
+   * @brief Like save(), but only sanitizing and copying the values happens on
+   * the calling thread. Formatting and writing the file run on the background
+   * thread of the SaveWorker, which reads the source file again so that its
+   * entries of unregistered variables are kept. The document used by save()
+   * and the reload functions is not touched.
+   * All async saves of the process are written one after another in the
+   * order they were requested, so the file ends up with the values of the
+   * latest call. Wait for the future before calling save() on the same file.
+   * Throws if no file name was set.
+   * @return Becomes ready when the file is written. get() throws if the file
+   * could not be parsed or written.
    */
-  bool deleteFile() {
-    if (std::filesystem::exists(source)) {
-      return std::filesystem::remove(source);
+  std::future<void> saveAsync() {
+    if (source.empty()) {
+      throw std::runtime_error(class_name +
+                               "::saveAsync: You did not set a file name!");
     }
-    return true;
+
+    return SaveWorker::instance()->enqueue(snapshotWrite());
   }
 
- private:
   /*!
-   * @brief registers membervariable
-   * if value was found in xml, overwrite member variable with value from xml.
-   * Throws if parsing error occured while reading file.
-   * @param name ID of membervariable
-   * @param ignore_read_error does not throw if true.
-   * return true if variable existed and was overwritten.
+   * @brief Sets the timing of requestSave(). Pending requests of the previous
+   * timing are written first.
+   * @param window Writes once no new request came in for this time.
+   * @param max_latency Writes at the latest this time after the first pending
+   * request, even if requests keep coming in.
    */
-  [[nodiscard]] bool loadIf(const std::string& name, bool ignore_read_error) {
-
-    DatamapIt settings_data_it = data.find(name);
-    assert(("Settings::loadIf: Did not found requested " + name).c_str() &&
-           settings_data_it != data.end());
+  void setSaveCoalescing(std::chrono::milliseconds window, std::chrono::milliseconds max_latency) {
+    save_scheduler.reset();
+    save_scheduler = std::make_unique<SaveScheduler>(window, max_latency);
+  }
 
-    XMLElement* xml_element = settings->FirstChildElement(name.c_str());
-    if (xml_element == nullptr) {
-      return false;
+  /*!
+   * @brief Requests a save without writing the file right away. Like in
+   * saveAsync(), the values are sanitized and copied on the calling thread
+   * and written in the background. Requests following each other within the
+   * window of setSaveCoalescing() (default 100 ms, at most 1 s) replace each
+   * other, so only the latest values are written once. Pending requests are
+   * written on destruction.
+   * Throws if no file name was set.
+   */
+  void requestSave() {
+    if (source.empty()) {
+      throw std::runtime_error(class_name +
+                               "::requestSave: You did not set a file name!");
     }
-    const XMLError error = load(xml_element, settings_data_it);
-    // We only throw if we could not parse, but there was data (which is
-    // corrupted). We dont throw if there wasnt data at all: error ==
-    // XML_NO_TEXT_NODE. (Just use default). We dont throw if the programmer
-    // decided that it is ok to use default value if data is corrupted.
-    if (error != XMLError::XML_SUCCESS && !ignore_read_error && error != XML_NO_TEXT_NODE) {
-      throw std::runtime_error(class_name + "::loadIf: The file " +
-                               source.string() + "had an entry " + name +
-                               " But could not be parsed.");
+    if (!save_scheduler) {
+      setSaveCoalescing(DEFAULT_SAVE_WINDOW, DEFAULT_SAVE_MAX_LATENCY);
     }
-    return true;
+    save_scheduler->request(snapshotWrite());
   }
 
   /*!
-   * @brief get the name of child nodes (array entry)
-   * @param i position in array.
-   * return name of child node
+   * @brief Writes the pending request of requestSave() now and waits for it.
+   * Throws if one of the writes since the last flush could not parse or write
+   * the file.
    */
-  std::string static getChildName(int i) {
-    return std::string("_" + std::to_string(i));
+  void flushSaves() {
+    if (save_scheduler) {
+      save_scheduler->flush();
+    }
   }
 
   /*!
-   * @brief Loads the found value of the (stored) xml in to variable.
-   * @param xml_element Valid pointer to the element which stores the variable
-   * (or parent if array). @param settings_data_it Valid interator to this->data
-   * entry (storing pointer type and size) return XMLError errorflag showing if
-   * parsing was successfull.
+   * @return How often requestSave() was called and how often the file was
+   * written for it.
    */
-  [[nodiscard]] XMLError load(const XMLElement* xml_element, const DatamapIt settings_data_it) {
-
-    auto load_ = [this](VariantData& variant_data, const XMLElement* child, int increment) -> XMLError {
-      XMLError error;
-      std::visit(
-        [this, &child, &increment, &error](auto&& visited_data) -> void {
-          error = this->loadData(child, visited_data, increment);
-        },
-        variant_data);
-      return error;
-    };
-
-    if (settings_data_it->second.size > 1) {
-      for (int i = 0; i < settings_data_it->second.size; ++i) {
-        const std::string child_name = getChildName(i);
-        const XMLElement* child = xml_element->FirstChildElement(child_name.c_str());
-        assert("Settings::load: Child element (Array element) is missing." && child != nullptr);
-        if (child != nullptr) {
-
-          const XMLError e = load_(settings_data_it->second.data, child, i);
-
-          if (e != XMLError::XML_SUCCESS) {
-            return e;
-          }
-        }
-      }
-      settings_data_it->second.sanitize();
-      return XMLError::XML_SUCCESS;
-    } else {
-      const XMLError e = load_(settings_data_it->second.data, xml_element, 0);
-      if (e == XMLError::XML_SUCCESS) {
-        settings_data_it->second.sanitize();
-      }
-      return e;
+  [[nodiscard]] SaveCounters saveCounters() const {
+    if (!save_scheduler) {
+      return {};
     }
+    return save_scheduler->saveCounters();
   }
 
-  /// <Loading methodes>
-
-  // <TYPE_SUPPORT> Define your own loadYourType methode which loads your Type
-  // from XML into the pointer
-
   /*!
-   * @brief Loads stored bool value into member variable.
-   * @param xml_element Valid pointer to the element which stores the variable.
-   * @param bool_data bool pointer to member variable or begin of array.
-   * @param increment Position in member variable array, or 0 if not array but
-   * simple member variable. return XMLError errorflag showing if parsing was
-   * successfull.
+   * @brief Makes the next save() write every variable, even the unchanged
+   * ones. E.g. to rewrite entries loaded in another representation (like
+   * packed arrays) in the one of the codec.
    */
-  [[nodiscard]] XMLError loadData(const XMLElement* xml_element, bool* bool_data, int increment) {
-    return xml_element->QueryBoolText(bool_data + increment);
+  void markAllChanged() {
+    for (auto& [name, entry] : data) {
+      entry.fingerprint.reset();
+      entry.entry_in_sync = false;
+    }
   }
 
   /*!
-   * @brief Loads stored int value into member variable.
-   * @param xml_element Valid pointer to the element which stores the variable.
-   * @param int_data int pointer to member variable or begin of array.
-   * @param increment Position in member variable array, or 0 if not array but
-   * simple member variable. return XMLError errorflag showing if parsing was
-   * successfull.
+   * @brief Writes all values of registered members into given file.
+   * Throws if parsing error occured or file could not be written.
+   * @param new_source The file and path to write into.
+   * @return The names of the variables which were written into the document.
    */
-  [[nodiscard]] XMLError loadData(const XMLElement* xml_element, int* int_data, int increment) {
-    return xml_element->QueryIntText(int_data + increment);
+  std::vector<std::string> save(const std::filesystem::path& new_source) {
+    source = new_source;
+    return save();
   }
 
   /*!
-   * @brief Loads stored int64_t value into member variable.
-   * @param xml_element Valid pointer to the element which stores the variable.
-   * @param int64_data int64_t pointer to member variable or begin of array.
-   * @param increment Position in member variable array, or 0 if not array but
-   * simple member variable. return XMLError errorflag showing if parsing was
-   * successfull.
+   * @brief Writes all values of registered members in the compact binary
+   * format (see binary.hpp) instead of xml. Sanitizes like save().
+   * @return The encoded bytes.
    */
-  [[nodiscard]] XMLError loadData(const XMLElement* xml_element, int64_t* int64_data, int increment) {
-    return xml_element->QueryInt64Text(int64_data + increment);
+  [[nodiscard]] std::vector<char> saveBinary() {
+    materializeAll();
+    BinaryWriter writer;
+    writer.writeHeader(data.size());
+    for (auto& [name, entry] : data) {
+      entry.sanitize();
+      const size_t length_position = writer.beginEntry(name, entry.operations->binary_type_tag);
+      entry.operations->encode(writer, entry.values, entry.size);
+      writer.endEntry(length_position);
+    }
+    return writer.release();
   }
 
   /*!
-   * @brief Loads stored unsigned int value into member variable.
-   * @param xml_element Valid pointer to the element which stores the variable.
-   * @param unsigned_data unsigned int pointer to member variable or begin of
-   * array. @param increment Position in member variable array, or 0 if not
-   * array but simple member variable. return XMLError errorflag showing if
-   * parsing was successfull.
+   * @brief Writes all values of registered members in the compact binary
+   * format into the given file. Does not change the xml source file.
+   * Throws if the file could not be written.
+   * @param binary_file The file and path to write into.
    */
-  [[nodiscard]] XMLError loadData(const XMLElement* xml_element,
-                                  unsigned int* unsigned_data,
-                                  int increment) {
-    return xml_element->QueryUnsignedText(unsigned_data + increment);
+  void saveBinary(const std::filesystem::path& binary_file) {
+    const std::vector<char> bytes = saveBinary();
+    const bool saved = writeFile(binary_file, save_durability, [&bytes](const std::filesystem::path& path) {
+      std::ofstream file(path, std::ios::binary | std::ios::trunc);
+      file.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+      return static_cast<bool>(file);
+    });
+    if (!saved) {
+      throw std::runtime_error(class_name + "::saveBinary: The file " +
+                               binary_file.string() + "could not be written.");
+    }
   }
 
   /*!
-   * @brief Loads stored uint64_t value into member variable.
-   * @param xml_element Valid pointer to the element which stores the variable.
-   * @param uint64_data uint64_t pointer to member variable or begin of array.
-   * @param increment Position in member variable array, or 0 if not array but
-   * simple member variable. return XMLError errorflag showing if parsing was
-   * successfull.
+   * @brief Writes the values into all member variables found in the given
+   * binary buffer (see saveBinary()). The buffer is only read during the call.
+   * @param bytes The encoded bytes.
+   * @return a vector of all variables, which could not be read. Possible reasons: The header is invalid, the buffer did not contain the variable, or the stored value does not match the type of the variable. Those variables keep their value.
    */
-  [[nodiscard]] XMLError loadData(const XMLElement* xml_element, uint64_t* uint64_data, int increment) {
-    return xml_element->QueryUnsigned64Text(uint64_data + increment);
-  }
+  std::vector<std::string> reloadAllFromBinary(std::span<const char> bytes) {
+    std::vector<std::string> bad_variables{};
+    BinaryReader reader(bytes);
+    uint32_t entry_count = 0;
+    if (!reader.readHeader(entry_count)) {
+      bad_variables.reserve(data.size());
+      for (DatamapIt it = data.begin(); it != data.end(); ++it) {
+        bad_variables.push_back(it->first);
+      }
+      return bad_variables;
+    }
 
+    resetFoundInDocument();
+    std::string_view name;
+    uint32_t type_tag = 0;
+    std::span<const char> payload;
+    for (uint32_t i = 0; i < entry_count && reader.readEntry(name, type_tag, payload); ++i) {
+      const DatamapIt it = findUnvisited(name);
+      if (it == data.end()) {
+        continue;
+      }
+      if (!loadBinary(type_tag, payload, it)) {
+        bad_variables.push_back(it->first);
+      }
+    }
 
-  /*!
-   * @brief Loads stored float value into member variable.
-   * @param xml_element Valid pointer to the element which stores the variable.
-   * @param float_data float pointer to member variable or begin of array.
-   * @param increment Position in member variable array, or 0 if not array but
-   * simple member variable. return XMLError errorflag showing if parsing was
-   * successfull.
-   */
-  [[nodiscard]] XMLError loadData(const XMLElement* xml_element, float* float_data, int increment) {
-    return xml_element->QueryFloatText(float_data + increment);
+    for (DatamapIt it = data.begin(); it != data.end(); ++it) {
+      if (!it->second.found_in_document) {
+        bad_variables.push_back(it->first);
+      }
+    }
+    return bad_variables;
   }
 
   /*!
-   * @brief Loads stored double value into member variable.
-   * @param xml_element Valid pointer to the element which stores the variable.
-   * @param double_data double pointer to member variable or begin of array.
-   * @param increment Position in member variable array, or 0 if not array but
-   * simple member variable. return XMLError errorflag showing if parsing was
-   * successfull.
+   * @brief Writes the values into all member variables found in the given
+   * binary file (see saveBinary(const std::filesystem::path&)).
+   * @param binary_file The file and path to read from.
+   * @return a vector of all variables, which could not be read. Possible reasons: File does not exist, File did not contain the variable, the stored value does not match the type of the variable.
    */
-  [[nodiscard]] XMLError loadData(const XMLElement* xml_element, double* double_data, int increment) {
-    return xml_element->QueryDoubleText(double_data + increment);
+  std::vector<std::string> reloadAllFromBinaryFile(const std::filesystem::path& binary_file) {
+    const MappedFile mapped_file(binary_file);
+    if (mapped_file.status() == MappedFile::Status::Ok) {
+      return reloadAllFromBinary(std::span<const char>(mapped_file.data(), mapped_file.size()));
+    }
+    std::ifstream file(binary_file, std::ios::binary);
+    const std::vector<char> bytes((std::istreambuf_iterator<char>(file)),
+                                  std::istreambuf_iterator<char>());
+    return reloadAllFromBinary(bytes);
   }
 
   /*!
-   * @brief Loads stored string value into member variable.
-   * @param xml_element Valid pointer to the element which stores the variable.
-   * @param string_data string pointer to member variable or begin of array.
-   * @param increment Position in member variable array, or 0 if not array but
-   * simple member variable. return XMLError errorflag showing if parsing was
-   * successfull.
+   * @brief Loads the value of a lazily registered variable (see
+   * setLazyLoading()) from the document and sanitizes it. Does nothing if it
+   * was loaded already. Throws like put() if the entry could not be parsed.
+   * @param name The name given to put().
+   * @return false if the variable is not registered or could not be loaded.
    */
-  [[nodiscard]] XMLError loadData(const XMLElement* xml_element,
-                                  std::string* string_data,
-                                  int increment) {
-    return xml_element->QueryStrText(string_data + increment);
+  bool materialize(std::string_view name) {
+    const DatamapIt it = data.find(name);
+    if (it == data.end()) {
+      return false;
+    }
+    return materialize(it);
   }
 
   /*!
-   * @brief Loads stored wstring value into member variable.
-   * @param xml_element Valid pointer to the element which stores the variable.
-   * @param wstring_data wstring pointer to member variable or begin of array.
-   * @param increment Position in member variable array, or 0 if not array but
-   * simple member variable. return XMLError errorflag showing if parsing was
-   * successfull.
+   * @brief Loads all lazily registered variables which were not loaded yet,
+   * see materialize().
+   * @return The variables which could not be loaded.
    */
-  [[nodiscard]] XMLError loadData(const XMLElement* xml_element,
-                                  std::wstring* wstring_data,
-                                  int increment) {
-    std::string s;
-    const XMLError retVal = xml_element->QueryStrText(&s);
-    if (retVal == XMLError::XML_SUCCESS) {
-      *(wstring_data + increment) = castToWstring(s);
-    }
-    return retVal;
+  std::vector<std::string> materializeAll() {
+    std::vector<std::string> bad_variables{};
+    for (DatamapIt it = data.begin(); it != data.end(); ++it) {
+      if (it->second.load_pending && !materialize(it)) {
+        bad_variables.push_back(it->first);
+      }
+    }
+    return bad_variables;
   }
 
   /*!
-   * @brief Loads stored char value into member variable.
-   * @param xml_element Valid pointer to the element which stores the variable.
-   * @param char_data char pointer to member variable or begin of array.
-   * @param increment Position in member variable array, or 0 if not array but
-   * simple member variable. return XMLError errorflag showing if parsing was
-   * successfull.
+   * @param name The name given to put().
+   * @return true if the variable is registered and its value is loaded.
    */
-  [[nodiscard]] XMLError loadData(const XMLElement* xml_element, char* char_data, int increment) {
-    std::string temp;
-    const XMLError error = xml_element->QueryStrText(&temp);
-    if (error != XMLError::XML_SUCCESS) {
-      return error;
-    }
-    assert(temp.size() == 1);
-    if (temp.size() != 1) {
-      return XML_CAN_NOT_CONVERT_TEXT;
-    }
-    *(char_data + increment) = temp[0];
-    return error;
+  [[nodiscard]] bool isMaterialized(std::string_view name) const {
+    const auto it = data.find(name);
+    return it != data.end() && !it->second.load_pending;
   }
 
   /*!
-   * @brief Loads stored wchar_t value into member variable.
-   * @param xml_element Valid pointer to the element which stores the variable.
-   * @param wchar_data wchar_t pointer to member variable or begin of array.
-   * @param increment Position in member variable array, or 0 if not array but
-   * simple member variable. return XMLError errorflag showing if parsing was
-   * successfull.
+   * @brief Watches the source file for changes made by others (e.g. an
+   * operator editing it), see FileWatcher. Changes written by save(),
+   * saveAsync() and requestSave() of this instance are ignored. Nothing is
+   * reloaded automatically: call reloadIfSourceChanged() on the thread which
+   * uses the settings. Watches the current source, call it again after
+   * changing the source file.
+   * @param debounce Bursts of changes within this time count as one.
+   * @param on_change Optional, called on the thread of the watcher after the
+   * file changed. E.g. to wake up the thread calling reloadIfSourceChanged().
+   * Only call reloadAllFromFile() from it if the settings are not used
+   * concurrently.
+   * @return false if the file can not be watched (directory does not exist,
+   * no inotify support).
    */
-  [[nodiscard]] XMLError loadData(const XMLElement* xml_element, wchar_t* wchar_data, int increment) {
-    std::string temp;
-    const XMLError error = xml_element->QueryStrText(&temp);
-    if (error != XMLError::XML_SUCCESS) {
-      return error;
-    }
-    assert(temp.size() <= 2);
-    if (temp.size() > 2) {
-      return XML_CAN_NOT_CONVERT_TEXT;
-    }
-    const std::wstring wtemp = castToWstring(temp);
-    assert(wtemp.size() == 1);
-    if (wtemp.size() != 1) {
-      return XML_CAN_NOT_CONVERT_TEXT;
-    }
-    *(wchar_data + increment) = wtemp[0];
-    return error;
+  bool watchSourceFile(std::chrono::milliseconds debounce, std::function<void()> on_change = {}) {
+    source_watcher.reset();
+    if (source.empty()) {
+      return false;
+    }
+    source_watcher = std::make_shared<FileWatcher>(source, debounce, std::move(on_change));
+    if (source_watcher->status() != FileWatcher::Status::Ok) {
+      source_watcher.reset();
+      return false;
+    }
+    return true;
   }
 
+  /*!
+   * @brief Stops watching the source file, see watchSourceFile().
+   */
+  void stopWatchingSourceFile() { source_watcher.reset(); }
 
   /*!
-   * @brief Loads stored vector data into member variable.
-   * @param xml_element Valid pointer to the element which stores the variable.
-   * @param data_ptr vector like pointer to member variable or begin of array.
-   * @param increment Position in member variable array, or 0 if not array but
-   * simple member variable. return XMLError errorflag showing if parsing was
-   * successfull.
+   * @brief Reloads the source file if the watcher of watchSourceFile() saw a
+   * change since the last call. Throws like reloadAllFromFile().
+   * @return Empty if nothing changed, otherwise the result of
+   * reloadAllFromFile().
    */
-  template <class VectorContainer>
-  [[nodiscard]] XMLError loadVectorData(const XMLElement* xml_element,
-                                        VectorContainer* data_ptr,
-                                        int increment) {
-    std::advance(data_ptr, increment);
-
-    int i                  = 0;
-    std::string child_name = getChildName(i++);
-    const XMLElement* child = xml_element->FirstChildElement(child_name.c_str());
-    std::vector<const XMLElement*> children;
-    while (child != nullptr) {
-      children.push_back(child);
-      child_name = getChildName(i++);
-      child      = xml_element->FirstChildElement(child_name.c_str());
-    }
-    data_ptr->resize(children.size());
-
-    auto it = data_ptr->begin();
-    for (const XMLElement* c : children) {
-      XMLError error = loadData(c, &(*it), 0);
-      if (error != XMLError::XML_SUCCESS) {
-        return error;
-      }
-      std::advance(it, 1);
+  std::optional<std::vector<std::string>> reloadIfSourceChanged() {
+    if (!source_watcher || !source_watcher->takeChange()) {
+      return std::nullopt;
     }
-    return XMLError::XML_SUCCESS;
-  }
-
-  template <class T>
-  [[nodiscard]] XMLError loadData(const XMLElement* xml_element,
-                                  std::vector<T>* data_ptr,
-                                  int increment) {
-    return loadVectorData(xml_element, data_ptr, increment);
+    return reloadAllFromFile();
   }
 
-
-  template <class T>
-  [[nodiscard]] XMLError loadData(const XMLElement* xml_element, std::list<T>* data_ptr, int increment) {
-    return loadVectorData(xml_element, data_ptr, increment);
+  /*!
+   * @brief Publishes the values of all registered members in the binary
+   * format (see saveBinary()) into the shared memory segment, so that other
+   * processes can load them with reloadFromSharedMemory() instead of parsing
+   * the source file. Sanitizes like save().
+   * @param segment A segment opened for publishing.
+   * @return false if the segment is not open for publishing or too small.
+   */
+  bool publishToSharedMemory(SharedMemorySegment& segment) {
+    return segment.publish(saveBinary());
   }
 
   /*!
-   * @brief Loads stored set data into member variable.
-   * @param xml_element Valid pointer to the element which stores the variable.
-   * @param data_ptr set like pointer to member variable or begin of array.
-   * @param increment Position in member variable array, or 0 if not array but
-   * simple member variable. return XMLError errorflag showing if parsing was
-   * successfull.
+   * @brief Loads the values published into the shared memory segment by
+   * publishToSharedMemory() of another process, if they are newer than the
+   * ones loaded by the last call.
+   * @param segment A segment attached to. Mapped again if the publisher grew
+   * it.
+   * @return Empty if nothing (new) was published, otherwise the result of
+   * reloadAllFromBinary().
    */
-  template <template <typename> class SetContainer, typename T>
-  [[nodiscard]] XMLError loadSetData(const XMLElement* xml_element,
-                                     SetContainer<T>* data_ptr,
-                                     int increment) {
-    std::advance(data_ptr, increment);
-
-    int i = 0;
-    data_ptr->clear();
-    auto insertion_hint    = data_ptr->begin();
-    std::string child_name = getChildName(i++);
-    const XMLElement* child = xml_element->FirstChildElement(child_name.c_str());
-    while (child != nullptr) {
-      T temp;
-      XMLError error = loadData(child, &temp, 0);
-      if (error != XMLError::XML_SUCCESS) {
-        return error;
-      }
-      insertion_hint = data_ptr->insert(insertion_hint, temp);
-      child_name     = getChildName(i++);
-      child          = xml_element->FirstChildElement(child_name.c_str());
+  std::optional<std::vector<std::string>> reloadFromSharedMemory(SharedMemorySegment& segment) {
+    if (segment.generation() == shared_memory_generation) {
+      return std::nullopt;
     }
-
-    return XMLError::XML_SUCCESS;
-  }
-
-  template <class T>
-  [[nodiscard]] XMLError loadData(const XMLElement* xml_element, std::set<T>* data_ptr, int increment) {
-    return loadSetData(xml_element, data_ptr, increment);
-  }
-
-  template <class T>
-  [[nodiscard]] XMLError loadData(const XMLElement* xml_element,
-                                  std::multiset<T>* data_ptr,
-                                  int increment) {
-    return loadSetData(xml_element, data_ptr, increment);
-  }
-
-  template <class T>
-  [[nodiscard]] XMLError loadData(const XMLElement* xml_element,
-                                  std::unordered_set<T>* data_ptr,
-                                  int increment) {
-    return loadSetData(xml_element, data_ptr, increment);
+    uint64_t generation = 0;
+    if (!segment.read(shared_memory_bytes, generation) || generation == shared_memory_generation) {
+      return std::nullopt;
+    }
+    shared_memory_generation = generation;
+    return reloadAllFromBinary(shared_memory_bytes);
   }
 
   /*!
-   * @brief Loads stored map data into member variable.
-   * @param xml_element Valid pointer to the element which stores the variable.
-   * @param data_ptr map like pointer to member variable or begin of array.
-   * @param increment Position in member variable array, or 0 if not array but
-   * simple member variable. return XMLError errorflag showing if parsing was
-   * successfull.
+   * @brief Moves the xml file storing the data to the given destination.
+   * @return true if the move was sucessfull.
    */
-  template <template <typename, typename> class MapContainer, typename T1, typename T2>
-  [[nodiscard]] XMLError loadMapData(const XMLElement* xml_element,
-                                     MapContainer<T1, T2>* data_ptr,
-                                     int increment) {
-    std::advance(data_ptr, increment);
-
-    int i = 0;
-    data_ptr->clear();
-    std::string child_name             = getChildName(i++);
-    const std::string child_name_value = child_name;
-    const XMLElement* childKey = xml_element->FirstChildElement(child_name.c_str());
-    auto insertion_hint = data_ptr->begin();
-
-    while (childKey != nullptr) {
-      T1 key;
-      XMLError error = loadData(childKey, &key, 0);
-      if (error != XMLError::XML_SUCCESS) {
-        return error;
-      }
-      const XMLElement* childValue =
-        childKey->FirstChildElement(child_name_value.c_str());
-      if (childValue == nullptr) {
-        return XML_ERROR_PARSING;
+  bool moveFile(const std::filesystem::path& new_file) {
+    if (std::filesystem::exists(new_file)) {
+      return false;
+    }
+    const std::filesystem::path old_file(source);
+
+    if (std::filesystem::exists(old_file)) {
+      // copy old to new
+      if (!std::filesystem::copy_file(old_file, new_file)) {
+        return false;
       }
-      T2 value;
-      error = loadData(childValue, &value, 0);
-      if (error != XMLError::XML_SUCCESS) {
-        return error;
+      // delete old
+      if (!std::filesystem::remove(old_file)) {
+        if (!std::filesystem::remove(new_file)) {
+          // I cant even remove the file I just created??
+          throw std::runtime_error(
+            class_name + "::constructor: I was able to copy from (old) " +
+            old_file.string() + " to (new) " + new_file.string() +
+            " but I was not able to delete the old file. I was not able to "
+            "delete the newly created copy either. This smells like a "
+            "corrupt file system. Make sure to backup your data!");
+        }
+        return false;
       }
-      insertion_hint = data_ptr->insert(insertion_hint, {key, value});
-      child_name     = getChildName(i++);
-      childKey       = xml_element->FirstChildElement(child_name.c_str());
     }
+    source = new_file;
 
-    return XMLError::XML_SUCCESS;
+    return true;
   }
 
-  template <class T1, class T2>
-  [[nodiscard]] XMLError loadData(const XMLElement* xml_element,
-                                  std::map<T1, T2>* data_ptr,
-                                  int increment) {
-    return loadMapData(xml_element, data_ptr, increment);
-  }
-  template <class T1, class T2>
-  [[nodiscard]] XMLError loadData(const XMLElement* xml_element,
-                                  std::multimap<T1, T2>* data_ptr,
-                                  int increment) {
-    return loadMapData(xml_element, data_ptr, increment);
+  /*!
+   * @brief Deletes the xml file which stores the data. If save() is called,
+   * The file will created again.
+   * @return true if file could be deleted or did not exist in the first place.
+   * Return false if file still exists.
+   */
+  bool deleteFile() {
+    if (std::filesystem::exists(source)) {
+      return std::filesystem::remove(source);
+    }
+    return true;
   }
 
-  template <class T1, class T2>
-  [[nodiscard]] XMLError loadData(const XMLElement* xml_element,
-                                  std::unordered_map<T1, T2>* data_ptr,
-                                  int increment) {
-    return loadMapData(xml_element, data_ptr, increment);
+ private:
+  /*!
+   * @brief Marks all entries as not found in the document. Used before
+   * walking the stored entries once.
+   */
+  void resetFoundInDocument() {
+    for (auto& [name, entry] : data) {
+      entry.found_in_document = false;
+    }
   }
 
-  template <class T1, class T2>
-  [[nodiscard]] XMLError loadData(const XMLElement* xml_element,
-                                  std::unordered_multimap<T1, T2>* data_ptr,
-                                  int increment) {
-    return loadMapData(xml_element, data_ptr, increment);
+  /*!
+   * @brief Finds the variable belonging to the given stored entry and marks it
+   * as found. Entries which are not registered or which name a variable that
+   * was already found (duplicates, the first one wins) are skipped.
+   * @param entry Valid handle of an entry in the document.
+   * @return Iterator to the variable or data.end() if the entry should be skipped.
+   */
+  [[nodiscard]] DatamapIt findUnvisited(Entry entry) {
+    return findUnvisited(std::string_view(Codec::entryName(entry)));
   }
 
   /*!
-   * @brief Loads stored std::pair data into member variable.
-   * @param xml_element Valid pointer to the element which stores the variable.
-   * @param data_ptr std::pair pointer to member variable or begin of array.
-   * @param increment Position in member variable array, or 0 if not array but
-   * simple member variable. return XMLError errorflag showing if parsing was
-   * successfull.
+   * @brief Finds the entry with the given name and marks it as found. See
+   * findUnvisited(Entry).
+   * @param name The name of the stored entry.
+   * @return Iterator to the entry or data.end() if it should be skipped.
    */
-  template <class T1, class T2>
-  [[nodiscard]] XMLError loadData(const XMLElement* xml_element,
-                                  std::pair<T1, T2>* data_ptr,
-                                  int increment) {
-    std::advance(data_ptr, increment);
-
-    const XMLElement* childFirst =
-      xml_element->FirstChildElement(getChildName(0).c_str());
-    const XMLElement* childSecond =
-      xml_element->FirstChildElement(getChildName(1).c_str());
-
-    if (childFirst == nullptr || childSecond == nullptr) {
-      return XML_ERROR_PARSING;
-    }
-    XMLError error = loadData(childFirst, &(data_ptr->first), 0);
-    if (error != XMLError::XML_SUCCESS) {
-      return error;
-    }
-    error = loadData(childSecond, &(data_ptr->second), 0);
-    if (error != XMLError::XML_SUCCESS) {
-      return error;
+  [[nodiscard]] DatamapIt findUnvisited(std::string_view name) {
+    const DatamapIt it = data.find(name);
+    if (it == data.end() || it->second.found_in_document) {
+      return data.end();
     }
-    return XMLError::XML_SUCCESS;
+    it->second.found_in_document = true;
+    return it;
   }
 
-
-
-  /// </Loading methodes>
-
   /*!
-   * @brief Read the xml file if it exists.
-   * @return XMLError. Could be XMLError::XML_SUCCESS or XMLError::XML_ERROR_FILE_NOT_FOUND or XMLError::XML_ERROR_EMPTY_DOCUMENT or XMLError::XML_ERROR_FILE_READ_ERROR
+   * @brief See materialize(std::string_view).
+   * @param settings_data_it Valid interator to this->data entry.
+   * @return false if the variable could not be loaded.
    */
-  [[nodiscard]] XMLError loadFile() {
-    const XMLError error = source.empty()
-                             ? XMLError::XML_ERROR_FILE_NOT_FOUND
-                             : settingsDocument.LoadFile(source.string().c_str());
-    return prepareSettingsDocumentAfterLoad(error);
+  bool materialize(const DatamapIt settings_data_it) {
+    Data& settings_data = settings_data_it->second;
+    if (!settings_data.load_pending) {
+      return true;
+    }
+    settings_data.load_pending = false;
+    const Entry entry          = codec.find(settings_data_it->first);
+    if (entry == Entry{}) {
+      return false;
+    }
+    const CodecStatus status = load(entry, settings_data_it);
+    if (status == CodecStatus::Invalid && !settings_data.ignore_read_error) {
+      throw std::runtime_error(class_name + "::materialize: The file " +
+                               source.string() + "had an entry " + settings_data_it->first +
+                               " But could not be parsed.");
+    }
+    return status == CodecStatus::Ok;
   }
 
   /*!
-   * @brief Given cache and its length, interprete it as xml.
-   * @param xml A pointer to the cache begin
-   * @param bytes the number of bytes in the cache
-   * @return XMLError. Could be XMLError::XML_SUCCESS or XMLError::XML_ERROR_FILE_NOT_FOUND or XMLError::XML_ERROR_EMPTY_DOCUMENT or XMLError::XML_ERROR_FILE_READ_ERROR
+   * @brief Loads the binary payload of one entry into the variable. The
+   * variable is left unchanged if the entry does not match it.
+   * @param type_tag The type tag of the entry (see binaryTypeTag()).
+   * @param payload The bytes of the entry (see binary.hpp).
+   * @param settings_data_it Valid interator to this->data entry.
+   * return true if the payload held exactly the values of the variable.
    */
-  [[nodiscard]] XMLError loadFromCache(const char* xml, size_t bytes) {
-    return prepareSettingsDocumentAfterLoad(settingsDocument.Parse(xml, bytes));
+  [[nodiscard]] bool loadBinary(uint32_t type_tag,
+                                std::span<const char> payload,
+                                const DatamapIt settings_data_it) {
+    Data& entry = settings_data_it->second;
+    if (type_tag != entry.operations->binary_type_tag) {
+      return false;
+    }
+    BinaryReader reader(payload);
+    if (!entry.operations->decode(reader, entry.values, entry.size)) {
+      return false;
+    }
+    entry.load_pending = false;
+    entry.sanitize();
+    return true;
   }
 
   /*!
-   * @brief After loading the document from file or cache, deal with Errors.
-   * @param error After loading the document.
-   * @return XMLError. Could be XMLError::XML_SUCCESS or XMLError::XML_ERROR_FILE_NOT_FOUND or XMLError::XML_ERROR_EMPTY_DOCUMENT or XMLError::XML_ERROR_FILE_READ_ERROR
+   * @brief registers membervariable
+   * if value was found in xml, overwrite member variable with value from xml.
+   * Throws if parsing error occured while reading file.
+   * @param name ID of membervariable
+   * @param ignore_read_error does not throw if true.
+   * return true if variable existed and was overwritten.
    */
-  [[nodiscard]] XMLError prepareSettingsDocumentAfterLoad(XMLError error) {
-    if (error != XMLError::XML_SUCCESS) {
-      if (error == XMLError::XML_ERROR_FILE_NOT_FOUND ||
-          error == XMLError::XML_ERROR_EMPTY_DOCUMENT) {
-        settingsDocument.ClearError();
-        settingsDocument.Clear();
-        // define root element
-        settings = settingsDocument.NewElement(class_name.c_str());
-        settingsDocument.InsertFirstChild(settings);
-      } else {
-        // other errors will be handled below
-        settings = nullptr;
-      }
+  [[nodiscard]] bool loadIf(const std::string& name, bool ignore_read_error) {
 
-    } else {
-      settings = settingsDocument.FirstChild();
-      if (settings == nullptr) {
-        error = XMLError::XML_ERROR_FILE_READ_ERROR;
-      }
-    }
+    DatamapIt settings_data_it = data.find(name);
+    assert(("Settings::loadIf: Did not found requested " + name).c_str() &&
+           settings_data_it != data.end());
 
-    // cannot handle these errors -> throw
-    if (error == XMLError::XML_ERROR_FILE_COULD_NOT_BE_OPENED) {
-      throw std::runtime_error(class_name + "::constructor: The file " +
-                               source.string() + "could not be opened.");
-    } else if (error == XMLError::XML_ERROR_FILE_READ_ERROR) {
-      throw std::runtime_error(class_name + "::constructor: The file " + source.string() +
-                               "could not be read. Maybe XML Syntax was made "
-                               "invalide while altering Settingsfile?");
-    } else if (settings == nullptr) {
-      throw std::runtime_error(
-        class_name + "::constructor: An unhandled Error occured: " + std::to_string(error));
+    const Entry entry = codec.find(name);
+    if (entry == Entry{}) {
+      return false;
+    }
+    settings_data_it->second.ignore_read_error = ignore_read_error;
+    if (lazy_loading) {
+      settings_data_it->second.load_pending = true;
+      return true;
     }
-    return error;
+    const CodecStatus status = load(entry, settings_data_it);
+    // We only throw if we could not parse, but there was data (which is
+    // corrupted). We dont throw if there wasnt data at all: status ==
+    // CodecStatus::NoValue. (Just use default). We dont throw if the programmer
+    // decided that it is ok to use default value if data is corrupted.
+    if (status == CodecStatus::Invalid && !ignore_read_error) {
+      throw std::runtime_error(class_name + "::loadIf: The file " +
+                               source.string() + "had an entry " + name +
+                               " But could not be parsed.");
+    }
+    return true;
   }
 
-
   /*!
-   * @brief Pre stores the value of a member variable.
-   * @param xml_element Valid pointer to the element which stores the variable.
+   * @brief Loads the found value of the stored entry in to the variable.
+   * @param entry Valid handle of the entry which stores the variable.
    * @param settings_data_it Valid interator to this->data entry (storing
    * pointer type and size)
+   * return CodecStatus showing if parsing was successfull.
    */
-  void save(XMLElement* xml_element, DatamapIt settings_data_it) {
-    if (xml_element == nullptr) {
-      xml_element = settingsDocument.NewElement(settings_data_it->first.c_str());
+  [[nodiscard]] CodecStatus load(Entry entry, const DatamapIt settings_data_it) {
+    Data& settings_data        = settings_data_it->second;
+    settings_data.load_pending = false;
+    const CodecStatus status =
+      settings_data.operations->read(codec, entry, settings_data.values, settings_data.size);
+    // Nothing is hashed here, see Data::entry_in_sync. If the sanitizer
+    // changes the value, the entry still holds the old one and the next
+    // save() rewrites it.
+    settings_data.fingerprint.reset();
+    settings_data.entry_in_sync = status == CodecStatus::Ok;
+    if (status == CodecStatus::Ok) {
+      settings_data.sanitize();
     }
-
-    settings_data_it->second.sanitize();
-
-    std::visit(
-      [this, &xml_element, &settings_data_it](auto&& visited_data) -> void {
-        this->savePrimitive(xml_element, visited_data, settings_data_it->second.size);
-      },
-      settings_data_it->second.data);
-  }
-
-  /// <Saving methodes>
-  /// <TYPE_SUPPORT> You need to define how your type should be stored
-
-  void setText(XMLElement* xml_element, const char char_data) {
-    // tinyXml does not support char, cast to std::string
-    std::string tmp(1, char_data);
-    xml_element->SetText(tmp);
-  }
-
-  void setText(XMLElement* xml_element, const wchar_t wchar_data) {
-    std::wstring tmp(1, wchar_data);
-    std::string stmp = castFromWstring(tmp);
-    xml_element->SetText(stmp);
+    return status;
   }
 
-  void setText(XMLElement* xml_element, const std::wstring& wchar_data) {
-    std::string stmp = castFromWstring(wchar_data);
-    xml_element->SetText(stmp);
-  }
-
-  void setText(XMLElement* xml_element, const std::string& string_data) {
-    // this is just so that we dont copy the string twice (SetText takes a copy) the templated version does too since the basic types are smaller than a reference pointer.
-    xml_element->SetText(string_data);
-  }
-
-  template <class T>
-  void setText(XMLElement* xml_element, const T t_data) {
-    xml_element->SetText(t_data);
-  }
   /*!
-   * @brief Stores the value of a member variable with basic type T.
-   * \tparam T Type of the to be stored variable
-   * @param xml_element Valid pointer to the element which stores the variable.
-   * @param data_ptr The Pointer to the Data to be stored
-   * @param int The size of the possible array (1 if no array)
+   * @brief Sanitizes and copies the values of all variables.
+   * @return Writes the copied values into the source file, see writeSnapshot().
    */
-  template <class T>
-  void savePrimitive(XMLElement* xml_element, T data_ptr, int size) {
-    if (size > 1) {
-      xml_element->DeleteChildren();
-      for (int i = 0; i < size; ++i) {
-        XMLElement* child = xml_element->InsertNewChildElement(getChildName(i).c_str());
-        setText(child, *data_ptr++);
-        xml_element->InsertEndChild(child);
-      }
-    } else {
-      setText(xml_element, *data_ptr);
+  [[nodiscard]] std::function<void()> snapshotWrite() {
+    materializeAll();
+    std::vector<SnapshotEntry> snapshot;
+    snapshot.reserve(data.size());
+    for (auto& [name, entry] : data) {
+      entry.sanitize();
+      snapshot.push_back({name, snapshotOf(entry)});
     }
-    settings->InsertEndChild(xml_element);
+    return [snapshot = std::move(snapshot), file = source, durability = save_durability,
+            name = class_name, watcher = std::weak_ptr<FileWatcher>(source_watcher)]() {
+      const std::shared_ptr<FileWatcher> own_watcher = watcher.lock();
+      const FileWatcher::OwnWrite own_write(own_watcher.get());
+      writeSnapshot(snapshot, file, durability, name);
+    };
   }
 
   /*!
-   * @brief Stores the value of a member variable with StlContainer type Container<T>.
-   * \tparam T Type of the to be stored variable
-   * @param xml_element Valid pointer to the element which stores the variable.
-   * @param data_ptr The Pointer to the Data  container to be stored
-   * @param int The size of the possible array (1 if no array)
+   * @brief Sanitizes the variable and prints it for saveStreaming().
+   * @param printer Receives the entry.
+   * @param settings_data_it Valid interator to this->data entry.
    */
-  template <typename Container>
-  void saveContainer(XMLElement* xml_element, Container* data_ptr, int size) {
-
-    auto save1Container = [this](XMLElement* parent, Container* data_ptr_lambda) {
-      parent->DeleteChildren();
-      int i = 0;
-      for (const auto& d : *data_ptr_lambda) {
-        XMLElement* child = parent->InsertNewChildElement(getChildName(i++).c_str());
-        this->setText(child, d);
-        parent->InsertEndChild(child);
-      }
-    };
-
-    if (size > 1) {
-      xml_element->DeleteChildren();
-      for (int i = 0; i < size; ++i) {
-        XMLElement* child = xml_element->InsertNewChildElement(getChildName(i).c_str());
-        save1Container(child, data_ptr++);
-        xml_element->InsertEndChild(child);
-      }
-
-    } else {
-      save1Container(xml_element, data_ptr);
-    }
+  static void print(StreamPrinter& printer, const DatamapIt settings_data_it) {
+    Data& settings_data = settings_data_it->second;
+    settings_data.sanitize();
+    settings_data.operations->print(
+      printer, settings_data_it->first, settings_data.values, settings_data.size);
+  }
 
-    settings->InsertEndChild(xml_element);
+  /*!
+   * @brief Copies the value of the variable for saveAsync().
+   * @param settings_data The variable.
+   * @return Writes the copy into an entry of a codec.
+   */
+  [[nodiscard]] static std::function<void(Codec&, Entry)> snapshotOf(const Data& settings_data) {
+    return settings_data.operations->snapshot(settings_data.values, settings_data.size);
   }
 
   /*!
-   * @brief Stores the value of a member variable with StlContainer type Container<T1, T2>.
-   * \tparam T Type of the to be stored variable
-   * @param xml_element Valid pointer to the element which stores the variable.
-   * @param data_ptr The Pointer to the Data  container to be stored
-   * @param int The size of the possible array (1 if no array)
+   * @brief Writes the values copied by snapshotWrite() into the file. Runs on the
+   * thread of the SaveWorker. Entries in the file are updated in place, the
+   * missing ones appended, like in save().
+   * Throws if the file could not be parsed or written.
+   * @param snapshot The copied values.
+   * @param file The file to write.
+   * @param durability How the file is written.
+   * @param name The class name, root of a new document.
    */
-  template <typename Container>
-  void saveMap(XMLElement* xml_element, Container* data_ptr, int size) {
-
-    auto save1Container = [](XMLElement* parent, Container* data_ptr_lambda) {
-      parent->DeleteChildren();
-      int i = 0;
-      for (const auto& [key, value] : *data_ptr_lambda) {
-        XMLElement* child = parent->InsertNewChildElement(getChildName(i++).c_str());
-        child->SetText(key);
-        XMLElement* childValue = child->InsertNewChildElement(getChildName(0).c_str());
-        childValue->SetText(value);
-        child->InsertEndChild(childValue);
-        parent->InsertEndChild(child);
-      }
-    };
+  static void writeSnapshot(const std::vector<SnapshotEntry>& snapshot,
+                            const std::filesystem::path& file,
+                            SaveDurability durability,
+                            const std::string& name) {
+    Codec codec;
+    const DocumentStatus status = codec.loadFile(file, FileLoadMode::Buffered);
+    if (status == DocumentStatus::NotFound || status == DocumentStatus::Empty) {
+      codec.clear(name);
+    } else if (status != DocumentStatus::Ok) {
+      throw std::runtime_error(name + "::writeSnapshot: The file " + file.string() +
+                               " could not be parsed: " + codec.errorText());
+    }
 
-    if (size > 1) {
-      xml_element->DeleteChildren();
-      for (int i = 0; i < size; ++i) {
-        XMLElement* child = xml_element->InsertNewChildElement(getChildName(i).c_str());
-        save1Container(child, data_ptr++);
-        xml_element->InsertEndChild(child);
+    std::unordered_map<std::string_view, const SnapshotEntry*> missing;
+    missing.reserve(snapshot.size());
+    for (const SnapshotEntry& entry : snapshot) {
+      missing.emplace(entry.name, &entry);
+    }
+    for (Entry entry = codec.firstEntry(); entry != Entry{}; entry = codec.nextEntry(entry)) {
+      const auto it = missing.find(std::string_view(Codec::entryName(entry)));
+      if (it != missing.end()) {
+        it->second->write(codec, entry);
+        missing.erase(it);
+      }
+    }
+    for (const SnapshotEntry& entry : snapshot) {
+      if (missing.contains(entry.name)) {
+        entry.write(codec, codec.appendEntry(entry.name));
       }
-
-    } else {
-      save1Container(xml_element, data_ptr);
     }
-    settings->InsertEndChild(xml_element);
-  }
-
-  template <class T>
-  void savePrimitive(XMLElement* xml_element, std::vector<T>* data_ptr, int size) {
-    saveContainer(xml_element, data_ptr, size);
-  }
-
-  template <class T>
-  void savePrimitive(XMLElement* xml_element, std::list<T>* data_ptr, int size) {
-    saveContainer(xml_element, data_ptr, size);
-  }
 
-  template <class T>
-  void savePrimitive(XMLElement* xml_element, std::set<T>* data_ptr, int size) {
-    saveContainer(xml_element, data_ptr, size);
+    const bool saved = writeFile(file, durability, [&codec](const std::filesystem::path& path) {
+      return codec.saveFile(path);
+    });
+    if (!saved) {
+      throw std::runtime_error(name + "::writeSnapshot: The file " + file.string() +
+                               " could not be written.");
+    }
   }
 
-  template <class T>
-  void savePrimitive(XMLElement* xml_element, std::multiset<T>* data_ptr, int size) {
-    saveContainer(xml_element, data_ptr, size);
+  /*!
+   * @brief Hashes the binary encoding of the value of the variable.
+   * @param settings_data The variable.
+   * @return The fingerprint.
+   */
+  [[nodiscard]] size_t fingerprintOf(const Data& settings_data) {
+    fingerprint_writer.clear();
+    settings_data.operations->encode(fingerprint_writer, settings_data.values, settings_data.size);
+    return hashOf(fingerprint_writer);
   }
 
-  template <class T>
-  void savePrimitive(XMLElement* xml_element, std::unordered_set<T>* data_ptr, int size) {
-    saveContainer(xml_element, data_ptr, size);
+  /*!
+   * @brief Hashes the bytes written so far.
+   * @param writer The writer holding the encoding.
+   * @return The fingerprint.
+   */
+  [[nodiscard]] static size_t hashOf(const BinaryWriter& writer) {
+    const std::vector<char>& bytes = writer.bytes();
+    return std::hash<std::string_view>{}(std::string_view(bytes.data(), bytes.size()));
   }
 
-  template <class T1, class T2>
-  void savePrimitive(XMLElement* xml_element, std::map<T1, T2>* data_ptr, int size) {
-    saveMap(xml_element, data_ptr, size);
-  }
-  template <class T1, class T2>
-  void savePrimitive(XMLElement* xml_element, std::multimap<T1, T2>* data_ptr, int size) {
-    saveMap(xml_element, data_ptr, size);
+  /*!
+   * @brief Checks if the value of the variable differs from the one stored
+   * in the document. Takes the fingerprint of the stored value from the
+   * entry if the variable was loaded from it.
+   * @param entry Valid handle of the entry which stores the variable.
+   * @param settings_data The variable.
+   * @return true if the variable must be written.
+   */
+  [[nodiscard]] bool isChanged(Entry entry, Data& settings_data) {
+    if (!settings_data.fingerprint.has_value() && settings_data.entry_in_sync) {
+      settings_data.fingerprint = settings_data.operations->stored_fingerprint(
+        codec, entry, fingerprint_writer, settings_data.size);
+    }
+    return !settings_data.fingerprint.has_value() ||
+           *settings_data.fingerprint != fingerprintOf(settings_data);
   }
 
-  template <class T1, class T2>
-  void savePrimitive(XMLElement* xml_element, std::unordered_map<T1, T2>* data_ptr, int size) {
-    saveMap(xml_element, data_ptr, size);
+  /*!
+   * @brief Read the source file if it exists.
+   * @return DocumentStatus::Ok, DocumentStatus::NotFound or DocumentStatus::Empty, throws otherwise.
+   */
+  [[nodiscard]] DocumentStatus loadFile() {
+    if (source.empty()) {
+      return prepareDocumentAfterLoad(DocumentStatus::NotFound);
+    }
+    return prepareDocumentAfterLoad(codec.loadFile(source, file_load_mode));
   }
 
-  template <class T1, class T2>
-  void savePrimitive(XMLElement* xml_element, std::unordered_multimap<T1, T2>* data_ptr, int size) {
-    saveMap(xml_element, data_ptr, size);
+  /*!
+   * @brief Given cache and its length, interprete it in the format of the codec.
+   * @param xml The cache, does not need to be null terminated.
+   * @return DocumentStatus::Ok, DocumentStatus::NotFound or DocumentStatus::Empty, throws otherwise.
+   */
+  [[nodiscard]] DocumentStatus loadFromCache(std::span<const char> xml) {
+    return prepareDocumentAfterLoad(codec.loadBuffer(xml));
   }
 
   /*!
-   * @brief Stores the value of a member variable with std::pair type Container<T1, T2>.
-   * \tparam T Type of the to be stored variable
-   * @param xml_element Valid pointer to the element which stores the variable.
-   * @param data_ptr The Pointer to the Data  container to be stored
-   * @param int The size of the possible array (1 if no array)
+   * @brief After loading the document from file or cache, deal with Errors.
+   * @param status After loading the document.
+   * @return DocumentStatus::Ok, DocumentStatus::NotFound or DocumentStatus::Empty, throws otherwise.
    */
-  template <class T1, class T2>
-  void savePrimitive(XMLElement* xml_element, std::pair<T1, T2>* data_ptr, int size) {
-    auto save1Container = [](XMLElement* parent, std::pair<T1, T2>* data_ptr_lambda) {
-      parent->DeleteChildren();
-
-      XMLElement* childFirst = parent->InsertNewChildElement(getChildName(0).c_str());
-      childFirst->SetText(data_ptr_lambda->first);
-      parent->InsertEndChild(childFirst);
-      XMLElement* childSecond = parent->InsertNewChildElement(getChildName(1).c_str());
-      childSecond->SetText(data_ptr_lambda->second);
-      parent->InsertEndChild(childSecond);
-    };
-
-    if (size > 1) {
-      xml_element->DeleteChildren();
-      for (int i = 0; i < size; ++i) {
-        XMLElement* child = xml_element->InsertNewChildElement(getChildName(i).c_str());
-        save1Container(child, data_ptr++);
-        xml_element->InsertEndChild(child);
-      }
-
-    } else {
-      save1Container(xml_element, data_ptr);
+  [[nodiscard]] DocumentStatus prepareDocumentAfterLoad(DocumentStatus status) {
+    // The fingerprints belonged to the previous document.
+    markAllChanged();
+    switch (status) {
+      case DocumentStatus::Ok:
+        break;
+      case DocumentStatus::NotFound:
+      case DocumentStatus::Empty:
+        codec.clear(class_name);
+        break;
+      // cannot handle these errors -> throw
+      case DocumentStatus::CouldNotOpen:
+        throw std::runtime_error(class_name + "::constructor: The file " +
+                                 source.string() + "could not be opened.");
+      case DocumentStatus::ReadError:
+        throw std::runtime_error(class_name + "::constructor: The file " + source.string() +
+                                 "could not be read. Maybe the Syntax was made "
+                                 "invalide while altering Settingsfile?");
+      case DocumentStatus::ParseError:
+        throw std::runtime_error(
+          class_name + "::constructor: An unhandled Error occured: " + codec.errorText());
     }
-    settings->InsertEndChild(xml_element);
+    return status;
   }
 
-  /// </Saving methodes>
-
-  std::string castFromWstring(const std::wstring& input) {
-    // Convert wstring to string using a wide-to-UTF-8 conversion
-    std::wstring_convert<std::codecvt_utf8<wchar_t>, wchar_t> converter;
-    return converter.to_bytes(input);
-  }
+  /*!
+   * @brief Pre stores the value of a member variable.
+   * @param entry Handle of the entry which stores the variable or Entry{} to
+   * append a new one.
+   * @param settings_data_it Valid interator to this->data entry (storing
+   * pointer type and size)
+   */
+  void save(Entry entry, DatamapIt settings_data_it) {
+    if (entry == Entry{}) {
+      entry = codec.appendEntry(settings_data_it->first);
+    }
 
-  std::wstring castToWstring(const std::string& input) {
-    // Convert string to wstring using a UTF-8-to-wide conversion
-    std::wstring_convert<std::codecvt_utf8<wchar_t>, wchar_t> converter;
-    return converter.from_bytes(input);
+    Data& settings_data = settings_data_it->second;
+    settings_data.sanitize();
+    settings_data.operations->write(codec, entry, settings_data.values, settings_data.size);
+    settings_data.fingerprint   = fingerprintOf(settings_data);
+    settings_data.entry_in_sync = true;
   }
 
   std::string class_name = "Settings";
+  bool lazy_loading      = false;
   std::filesystem::path source;
+  FileLoadMode file_load_mode    = FileLoadMode::Buffered;
+  SaveDurability save_durability = SaveDurability::Direct;
 
   Datamap data;
 
-  XMLDocument settingsDocument;
-  XMLNode* settings = nullptr;
+  Codec codec;
+
+  // Reused to encode the values for their fingerprint.
+  BinaryWriter fingerprint_writer;
+
+  // Generation of the publication last loaded by reloadFromSharedMemory()
+  // and the buffer its payload is copied into.
+  uint64_t shared_memory_generation = 0;
+  std::vector<char> shared_memory_bytes;
+
+  // Shared with the pending background writes, which record their write.
+  std::shared_ptr<FileWatcher> source_watcher;
+
+  static constexpr std::chrono::milliseconds DEFAULT_SAVE_WINDOW{100};
+  static constexpr std::chrono::milliseconds DEFAULT_SAVE_MAX_LATENCY{1000};
+  // Created by the first requestSave() or setSaveCoalescing(). Declared last,
+  // so the pending write is done before the other members are destroyed.
+  std::unique_ptr<SaveScheduler> save_scheduler;
 };
 
 }  // namespace util
@@ -0,0 +1,361 @@
+/**
+ * @file sharedMemory.hpp
+ * @brief Contains the shared memory segment through which one process publishes loaded settings to others.
+ *
+ * Layout of the segment (native byte order, the processes share one host):
+ *   header:  "STSH" | uint32 layout version | uint64 capacity | uint64 generation | uint64 size
+ *   payload: capacity bytes, the first size bytes are valid
+ * The payload is the binary format of binary.hpp. The generation is a
+ * sequence lock: odd while the publisher writes, incremented by two per
+ * publication and when the segment is grown, 0 if nothing was published yet.
+ *
+ * @date 16.10.2026
+ * @author Jakob Wandel
+ * @version 1.0
+ **/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define SETTINGS_HAS_SHM 1
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#define SETTINGS_HAS_SHM 0
+#endif
+
+namespace util {
+
+/**
+ * @brief A POSIX shared memory segment holding the binary encoding of one
+ * Settings class. One process (the publisher) creates it and publishes, any
+ * number of processes attach read-only and copy the latest publication out.
+ * Readers never block the publisher: a publication which overlaps a read makes
+ * the reader retry.
+ **/
+class SharedMemorySegment {
+ public:
+  enum class Status {
+    Ok,
+    // Attach: no segment with that name.
+    NotFound,
+    CouldNotOpen,
+    // The segment was created by an incompatible version of this library.
+    Incompatible,
+    NotSupported,
+  };
+
+  static constexpr std::array<char, 4> MAGIC = {'S', 'T', 'S', 'H'};
+  static constexpr uint32_t LAYOUT_VERSION   = 1;
+
+  /**
+   * @brief Creates the segment or opens it if it exists, for publishing.
+   * Check status() before publishing.
+   * @param name The name of the segment, "/name" (see shm_open()).
+   * @param capacity The maximal size of a publication in bytes. An existing
+   * segment with a smaller capacity is grown.
+   **/
+  SharedMemorySegment(const std::string& name, size_t capacity) {
+#if SETTINGS_HAS_SHM
+    const int fd = ::shm_open(name.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);  // NOLINT(cppcoreguidelines-pro-type-vararg) POSIX API
+    if (fd < 0) {
+      status_ = Status::CouldNotOpen;
+      return;
+    }
+    struct stat segment_stat {};
+    const size_t needed = sizeof(Header) + capacity;
+    if (::fstat(fd, &segment_stat) != 0) {
+      ::close(fd);
+      status_ = Status::CouldNotOpen;
+      return;
+    }
+    size_t mapped = static_cast<size_t>(segment_stat.st_size);
+    bool grown    = false;
+    if (mapped < needed) {
+      if (::ftruncate(fd, static_cast<off_t>(needed)) != 0) {
+        ::close(fd);
+        status_ = Status::CouldNotOpen;
+        return;
+      }
+      mapped = needed;
+      grown  = true;
+    }
+    map(fd, mapped, PROT_READ | PROT_WRITE);
+    if (status_ != Status::Ok) {
+      return;
+    }
+    if (!compatible()) {
+      // New or left by another version: start without publication.
+      header()->magic          = MAGIC;
+      header()->layout_version = LAYOUT_VERSION;
+      header()->capacity       = mapped - sizeof(Header);
+      generationRef().store(0, std::memory_order_release);
+      std::atomic_ref<uint64_t>(header()->size).store(0, std::memory_order_relaxed);
+    } else if (grown) {
+      // Grown: ftruncate() kept the payload. The generation keeps increasing,
+      // so readers never take a later publication for one they loaded. A
+      // publication torn by a crashed publisher (odd generation) is dropped.
+      std::atomic_ref<uint64_t> generation_ref = generationRef();
+      const uint64_t generation = generation_ref.load(std::memory_order_relaxed);
+      generation_ref.store(generation | 1U, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_release);
+      header()->capacity = mapped - sizeof(Header);
+      if (generation % 2 == 1) {
+        std::atomic_ref<uint64_t>(header()->size).store(0, std::memory_order_relaxed);
+      }
+      generation_ref.store((generation | 1U) + 1, std::memory_order_release);
+    }
+#else
+    static_cast<void>(name);
+    static_cast<void>(capacity);
+#endif
+  }
+
+  /**
+   * @brief Attaches read-only to an existing segment. Check status() before
+   * reading.
+   * @param name The name of the segment, "/name" (see shm_open()).
+   **/
+  explicit SharedMemorySegment(const std::string& name) {
+#if SETTINGS_HAS_SHM
+    const int fd = ::shm_open(name.c_str(), O_RDONLY | O_CLOEXEC, 0);  // NOLINT(cppcoreguidelines-pro-type-vararg) POSIX API
+    if (fd < 0) {
+      status_ = errno == ENOENT ? Status::NotFound : Status::CouldNotOpen;
+      return;
+    }
+    struct stat segment_stat {};
+    if (::fstat(fd, &segment_stat) != 0 ||
+        static_cast<size_t>(segment_stat.st_size) < sizeof(Header)) {
+      ::close(fd);
+      status_ = Status::Incompatible;
+      return;
+    }
+    // Kept open to follow a publisher growing the segment, see read().
+    map(fd, static_cast<size_t>(segment_stat.st_size), PROT_READ, true);
+    if (status_ == Status::Ok && !compatible()) {
+      status_ = Status::Incompatible;
+    }
+#else
+    static_cast<void>(name);
+#endif
+  }
+
+  ~SharedMemorySegment() {
+#if SETTINGS_HAS_SHM
+    if (data_ != nullptr) {
+      ::munmap(data_, size_);
+    }
+    if (fd_ >= 0) {
+      ::close(fd_);
+    }
+#endif
+  }
+
+  SharedMemorySegment(const SharedMemorySegment&)            = delete;
+  SharedMemorySegment& operator=(const SharedMemorySegment&) = delete;
+  SharedMemorySegment(SharedMemorySegment&&)                 = delete;
+  SharedMemorySegment& operator=(SharedMemorySegment&&)      = delete;
+
+  /**
+   * @brief Removes the name of the segment. Attached processes keep their
+   * mapping.
+   * @param name The name of the segment.
+   * @return true if it was removed.
+   **/
+  static bool remove(const std::string& name) {
+#if SETTINGS_HAS_SHM
+    return ::shm_unlink(name.c_str()) == 0;
+#else
+    static_cast<void>(name);
+    return false;
+#endif
+  }
+
+  [[nodiscard]] Status status() const { return status_; }
+
+  /**
+   * @return The maximal size of a publication.
+   **/
+  [[nodiscard]] size_t capacity() const {
+    return status_ == Status::Ok ? mappedCapacity() : 0;
+  }
+
+  /**
+   * @return The generation of the latest publication, 0 if there is none.
+   * Odd while a publication is written.
+   **/
+  [[nodiscard]] uint64_t generation() const {
+    return status_ == Status::Ok ? generationRef().load(std::memory_order_acquire) : 0;
+  }
+
+  /**
+   * @brief Publishes the bytes. Only one process may publish into a segment.
+   * @param bytes The payload.
+   * @return false if the segment is not open for publishing or the bytes do
+   * not fit.
+   **/
+  [[nodiscard]] bool publish(std::span<const char> bytes) {
+    if (status_ != Status::Ok || !writable || bytes.size() > mappedCapacity()) {
+      return false;
+    }
+    std::atomic_ref<uint64_t> generation_ref = generationRef();
+    const uint64_t generation = generation_ref.load(std::memory_order_relaxed);
+    generation_ref.store(generation + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    std::memcpy(payload(), bytes.data(), bytes.size());
+    std::atomic_ref<uint64_t>(header()->size).store(bytes.size(), std::memory_order_relaxed);
+    generation_ref.store(generation + 2, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * @brief Copies the latest publication. If the publisher grew the segment
+   * since it was attached, it is mapped again with the new size.
+   * @param bytes Receives the payload.
+   * @param generation Receives the generation of the payload.
+   * @return false if nothing was published yet, the segment could not be
+   * mapped again or the publisher kept writing during every attempt.
+   **/
+  [[nodiscard]] bool read(std::vector<char>& bytes, uint64_t& generation) {
+    if (status_ != Status::Ok) {
+      return false;
+    }
+    constexpr int MAX_ATTEMPTS = 1000;
+    for (int attempt = 0; attempt < MAX_ATTEMPTS; ++attempt) {
+      const uint64_t before = generationRef().load(std::memory_order_acquire);
+      if (before == 0) {
+        return false;
+      }
+      if (before % 2 == 1) {
+        std::this_thread::yield();
+        continue;
+      }
+      const uint64_t size =
+        std::atomic_ref<uint64_t>(header()->size).load(std::memory_order_relaxed);
+      // Read the size of our own mapping, the header lives in shared memory.
+      if (size > size_ - sizeof(Header)) {
+        if (!remap()) {
+          return false;
+        }
+        continue;
+      }
+      if (size == 0) {
+        // Dropped when the segment was grown after a crashed publication.
+        return false;
+      }
+      bytes.resize(size);
+      std::memcpy(bytes.data(), payload(), size);
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (generationRef().load(std::memory_order_relaxed) == before) {
+        generation = before;
+        return true;
+      }
+    }
+    return false;
+  }
+
+ private:
+  struct Header {
+    std::array<char, 4> magic;
+    uint32_t layout_version;
+    uint64_t capacity;
+    // Accessed through std::atomic_ref, shared between processes.
+    uint64_t generation;
+    uint64_t size;
+  };
+  static_assert(std::atomic_ref<uint64_t>::is_always_lock_free,
+                "The sequence lock must work between processes.");
+
+#if SETTINGS_HAS_SHM
+  /**
+   * @brief Maps the segment. The descriptor is closed unless it is kept.
+   **/
+  void map(int fd, size_t size, int protection, bool keep_descriptor = false) {
+    void* mapping = ::mmap(nullptr, size, protection, MAP_SHARED, fd, 0);
+    // The mapping stays valid after closing the descriptor.
+    if (keep_descriptor && mapping != MAP_FAILED) {
+      fd_ = fd;
+    } else {
+      ::close(fd);
+    }
+    if (mapping == MAP_FAILED) {
+      status_ = Status::CouldNotOpen;
+      return;
+    }
+    data_    = static_cast<char*>(mapping);
+    size_    = size;
+    writable = (protection & PROT_WRITE) != 0;
+    status_  = Status::Ok;
+  }
+#endif
+
+  /**
+   * @brief Maps the segment of a reader again if it grew.
+   * @return false if it did not grow or could not be mapped.
+   **/
+  bool remap() {
+#if SETTINGS_HAS_SHM
+    struct stat segment_stat {};
+    if (fd_ < 0 || ::fstat(fd_, &segment_stat) != 0 ||
+        static_cast<size_t>(segment_stat.st_size) <= size_) {
+      return false;
+    }
+    const size_t size = static_cast<size_t>(segment_stat.st_size);
+    void* mapping     = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd_, 0);
+    if (mapping == MAP_FAILED) {
+      return false;
+    }
+    ::munmap(data_, size_);
+    data_ = static_cast<char*>(mapping);
+    size_ = size;
+    return true;
+#else
+    return false;
+#endif
+  }
+
+  /**
+   * @return The capacity of the payload, bounded by our own mapping: the
+   * header may already announce a segment grown by a publisher.
+   **/
+  [[nodiscard]] size_t mappedCapacity() const {
+    return std::min<size_t>(header()->capacity, size_ - sizeof(Header));
+  }
+
+  [[nodiscard]] bool compatible() const {
+    return header()->magic == MAGIC && header()->layout_version == LAYOUT_VERSION;
+  }
+
+  // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast) The mapping starts with the header.
+  [[nodiscard]] Header* header() const { return reinterpret_cast<Header*>(data_); }
+  // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+
+  [[nodiscard]] char* payload() const { return data_ + sizeof(Header); }
+
+  [[nodiscard]] std::atomic_ref<uint64_t> generationRef() const {
+    return std::atomic_ref<uint64_t>(header()->generation);
+  }
+
+  Status status_ = Status::NotSupported;
+  char* data_    = nullptr;
+  size_t size_   = 0;
+  // Only kept by readers.
+  int fd_        = -1;
+  bool writable  = false;
+};
+
+}  // namespace util
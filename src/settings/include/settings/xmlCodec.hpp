@@ -0,0 +1,1376 @@
+/**
+ * @file xmlCodec.hpp
+ * @brief Contains the xml storage format (codec) of the Settings class, based on tinyxml2.
+ *
+ * @date 16.10.2026
+ * @author Jakob Wandel
+ * @version 1.0
+ **/
+
+#pragma once
+
+#include <tinyxml2.h>
+
+#include <cassert>
+#include <charconv>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <map>
+#include <optional>
+#include <set>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <settings/bulkParse.hpp>
+#include <settings/charconv.hpp>
+#include <settings/codec.hpp>
+#include <settings/fileIo.hpp>
+#include <settings/xmlScanner.hpp>
+
+// If you want to support a new type, you must define the load methode for it.
+// The save methode is setText (see savePrimitive()), which uses std::to_chars
+// for numbers and SetText from tinyxml2.h otherwise. You might
+// need to write your own if your Type is not supported. search for
+// <TYPE_SUPPORT> in this file to find all places which need new definitions.
+
+namespace util {
+
+/**
+ * @brief How the xml codec saves arrays and vectors of numbers.
+ **/
+enum class NumericArrayEncoding {
+  // One child element "_<i>" per number.
+  Elements,
+  // All numbers in the text of one element: <name count="3">1 2.5 -3</name>
+  Packed,
+};
+
+/**
+ * @brief Stores the variables as child elements of a root element named
+ * after the Settings class. Arrays, containers and pairs store their values
+ * as children named "_0", "_1", ... A map entry is the key element holding
+ * the value as its only child "_0".
+ *
+ * Saving updates the elements in place, so elements the Settings class does
+ * not know (comments, variables of other versions) are kept.
+ *
+ * With NumericArrayEncoding::Packed, put<T, N> arrays and std::vector<T> of
+ * numbers are stored as one element holding the numbers separated by spaces
+ * and a count attribute. Loading detects both representations.
+ *
+ * @tparam Encoding How numeric arrays and vectors are saved.
+ **/
+template <NumericArrayEncoding Encoding = NumericArrayEncoding::Elements>
+class BasicXmlCodec {
+ public:
+  using XMLElement = tinyxml2::XMLElement;
+  using XMLError   = tinyxml2::XMLError;
+  using Entry      = XMLElement*;
+
+  /*!
+   * @brief Read the xml file.
+   * @param source The file to read.
+   * @param load_mode How the file is read.
+   * @return DocumentStatus::Ok, NotFound or Empty. Other results leave the codec without document.
+   */
+  [[nodiscard]] DocumentStatus loadFile(const std::filesystem::path& source, FileLoadMode load_mode) {
+    if (load_mode == FileLoadMode::MemoryMapped) {
+      const std::optional<XMLError> error = loadMappedFile(source);
+      if (error.has_value()) {
+        return prepareDocumentAfterLoad(*error);
+      }
+      // not mappable, fall back to reading the file.
+    }
+    return prepareDocumentAfterLoad(settingsDocument.LoadFile(source.string().c_str()));
+  }
+
+  /*!
+   * @brief Given cache and its length, interprete it as xml.
+   * @param xml The cache, does not need to be null terminated.
+   * @return DocumentStatus::Ok, NotFound or Empty. Other results leave the codec without document.
+   */
+  [[nodiscard]] DocumentStatus loadBuffer(std::span<const char> xml) {
+    // Parse() takes the length, so the buffer is neither scanned for a null
+    // terminator nor accessed after this call.
+    return prepareDocumentAfterLoad(settingsDocument.Parse(xml.data(), xml.size()));
+  }
+
+  /*!
+   * @brief Loads the file without building the document of the whole file,
+   * see loadStreaming(std::span<const char>, ...).
+   * @param source The file to read. Mapped read-only if possible, otherwise
+   * read into memory as a whole.
+   * @param take See loadStreaming(std::span<const char>, ...).
+   * @param load_entry See loadStreaming(std::span<const char>, ...).
+   * @return Like loadFile().
+   */
+  template <class TakeEntry, class LoadEntry>
+  [[nodiscard]] DocumentStatus loadStreaming(const std::filesystem::path& source,
+                                             TakeEntry&& take,
+                                             LoadEntry&& load_entry) {
+    const MappedFile mapped_file(source);
+    switch (mapped_file.status()) {
+      case MappedFile::Status::Ok:
+        return loadStreaming(std::span<const char>(mapped_file.data(), mapped_file.size()),
+                             std::forward<TakeEntry>(take),
+                             std::forward<LoadEntry>(load_entry));
+      case MappedFile::Status::NotFound:
+        return prepareDocumentAfterLoad(XMLError::XML_ERROR_FILE_NOT_FOUND);
+      case MappedFile::Status::CouldNotOpen:
+        return prepareDocumentAfterLoad(XMLError::XML_ERROR_FILE_COULD_NOT_BE_OPENED);
+      case MappedFile::Status::Empty:
+        return prepareDocumentAfterLoad(XMLError::XML_ERROR_EMPTY_DOCUMENT);
+      case MappedFile::Status::NotMappable:
+        break;
+    }
+    std::ifstream file(source, std::ios::binary);
+    if (!file) {
+      return prepareDocumentAfterLoad(XMLError::XML_ERROR_FILE_COULD_NOT_BE_OPENED);
+    }
+    const std::string text((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    return loadStreaming(std::span<const char>(text.data(), text.size()),
+                         std::forward<TakeEntry>(take),
+                         std::forward<LoadEntry>(load_entry));
+  }
+
+  /*!
+   * @brief Loads without building the document of the whole text: the
+   * elements below the root are found by scanTopLevelElements(), the taken
+   * ones are parsed one after the other into a small document and handed to
+   * load_entry. So no document holding all taken entries is built at once.
+   * The memory needed besides the text is the document of the entries not
+   * taken plus the document of the largest taken entry. The document of the
+   * codec only keeps the rest (declaration, comments, entries not taken), the
+   * taken entries are left as empty elements at their place. The rest is
+   * copied out of the text to parse it, the copy is freed before the first
+   * entry is loaded.
+   * @param xml The text, does not need to be null terminated.
+   * @param take Callable bool(std::string_view name), called once per entry
+   * in document order: true to load the entry with load_entry, false to keep
+   * it in the document.
+   * @param load_entry Callable void(Entry entry) loading a taken entry. The
+   * entry is valid during the call only.
+   * @return Like loadBuffer(). With ParseError the entries before the broken
+   * one might already be loaded.
+   */
+  template <class TakeEntry, class LoadEntry>
+  [[nodiscard]] DocumentStatus loadStreaming(std::span<const char> xml,
+                                             TakeEntry&& take,
+                                             LoadEntry&& load_entry) {
+    const std::string_view text(xml.data(), xml.size());
+    if (text.find_first_not_of(" \t\r\n") == std::string_view::npos) {
+      return prepareDocumentAfterLoad(XMLError::XML_ERROR_EMPTY_DOCUMENT);
+    }
+
+    std::vector<std::string_view> taken;
+    {
+      std::string rest;
+      size_t copied          = 0;
+      const bool well_formed = scanTopLevelElements(
+        text,
+        [&text, &take, &taken, &rest, &copied](std::string_view name, std::string_view element) {
+          if (!take(name)) {
+            return;
+          }
+          const auto begin = static_cast<size_t>(element.data() - text.data());
+          rest.append(text.substr(copied, begin - copied)).append("<").append(name).append("/>");
+          copied = begin + element.size();
+          taken.push_back(element);
+        });
+      if (!well_formed) {
+        return prepareDocumentAfterLoad(XMLError::XML_ERROR_PARSING);
+      }
+      rest.append(text.substr(copied));
+      // Parse() copies the text, rest is not needed afterwards.
+      const DocumentStatus status =
+        prepareDocumentAfterLoad(settingsDocument.Parse(rest.data(), rest.size()));
+      if (status != DocumentStatus::Ok) {
+        return status;
+      }
+    }
+
+    tinyxml2::XMLDocument entry_document;
+    for (const std::string_view element : taken) {
+      const XMLError error = entry_document.Parse(element.data(), element.size());
+      if (error != XMLError::XML_SUCCESS) {
+        last_error = error;
+        return DocumentStatus::ParseError;
+      }
+      load_entry(entry_document.RootElement());
+    }
+    return DocumentStatus::Ok;
+  }
+
+  /*!
+   * @brief Starts an empty document.
+   * @param root_name The name of the root element.
+   */
+  void clear(std::string_view root_name) {
+    settingsDocument.ClearError();
+    settingsDocument.Clear();
+    // define root element
+    settings = settingsDocument.NewElement(std::string(root_name).c_str());
+    settingsDocument.InsertFirstChild(settings);
+  }
+
+  /*!
+   * @brief Writes the document into the given file.
+   * @return true on success.
+   */
+  [[nodiscard]] bool saveFile(const std::filesystem::path& file) {
+    return settingsDocument.SaveFile(file.string().c_str()) == XMLError::XML_SUCCESS;
+  }
+
+  [[nodiscard]] std::string errorText() const {
+    return "XMLError " + std::to_string(last_error);
+  }
+
+  [[nodiscard]] Entry find(std::string_view name) {
+    return settings->FirstChildElement(std::string(name).c_str());
+  }
+
+  [[nodiscard]] Entry firstEntry() { return settings->FirstChildElement(); }
+
+  [[nodiscard]] Entry nextEntry(Entry entry) { return entry->NextSiblingElement(); }
+
+  [[nodiscard]] static std::string_view entryName(Entry entry) { return entry->Name(); }
+
+  [[nodiscard]] Entry appendEntry(std::string_view name) {
+    XMLElement* xml_element = settingsDocument.NewElement(std::string(name).c_str());
+    settings->InsertEndChild(xml_element);
+    return xml_element;
+  }
+
+  /*!
+   * @brief Hashes the text, attributes and children of the element.
+   * @param xml_element Valid pointer to the element which stores a variable.
+   * @return The hash, independent of the name of the element.
+   */
+  [[nodiscard]] static size_t entryHash(const XMLElement* xml_element) {
+    size_t hash = 0;
+    for (const tinyxml2::XMLAttribute* attribute = xml_element->FirstAttribute();
+         attribute != nullptr;
+         attribute = attribute->Next()) {
+      hashCombine(hash, std::hash<std::string_view>{}(attribute->Name()));
+      hashCombine(hash, std::hash<std::string_view>{}(attribute->Value()));
+    }
+    for (const tinyxml2::XMLNode* child = xml_element->FirstChild(); child != nullptr;
+         child = child->NextSibling()) {
+      // Names of child elements and text both come from Value().
+      hashCombine(hash, std::hash<std::string_view>{}(child->Value()));
+      if (const XMLElement* child_element = child->ToElement()) {
+        hashCombine(hash, entryHash(child_element));
+      }
+    }
+    return hash;
+  }
+
+  /*!
+   * @brief Loads the value of the (stored) xml in to the variable.
+   * @param xml_element Valid pointer to the element which stores the variable
+   * (or parent if array).
+   * @param values Pointer to the variable or begin of the array.
+   * @param size The size of the array (1 if no array).
+   * return CodecStatus showing if parsing was successfull.
+   */
+  template <class T>
+  [[nodiscard]] CodecStatus read(const XMLElement* xml_element, T* values, int size) {
+    if constexpr (CharconvNumber<T>) {
+      if (size > 1 && isPacked(xml_element)) {
+        return toStatus(loadPacked(xml_element, std::span<T>(values, static_cast<size_t>(size))));
+      }
+    }
+    if (size > 1) {
+      // walk the array elements in order, they must be named "_0", "_1", ...
+      const XMLElement* child = xml_element->FirstChildElement();
+      for (int i = 0; i < size; ++i) {
+        if (child == nullptr || !isChildName(child, static_cast<size_t>(i))) {
+          // Child element (Array element) is missing.
+          return toStatus(XMLError::XML_ERROR_PARSING);
+        }
+        const XMLError e = loadData(child, values, i);
+        if (e != XMLError::XML_SUCCESS) {
+          return toStatus(e);
+        }
+        child = child->NextSiblingElement();
+      }
+      return CodecStatus::Ok;
+    }
+    return toStatus(loadData(xml_element, values, 0));
+  }
+
+  /*!
+   * @brief Stores the value of the variable into the element.
+   * @param xml_element Valid pointer to the element which stores the variable.
+   * @param values Pointer to the variable or begin of the array.
+   * @param size The size of the array (1 if no array).
+   */
+  template <class T>
+  void write(XMLElement* xml_element, T* values, int size) {
+    if constexpr (CharconvNumber<T> && Encoding == NumericArrayEncoding::Packed) {
+      if (size > 1) {
+        savePacked(xml_element, std::span<const T>(values, static_cast<size_t>(size)));
+        return;
+      }
+    }
+    savePrimitive(xml_element, values, size);
+  }
+
+  /*!
+   * @brief Prints the variables of streaming saves (see StreamingCodec)
+   * directly into the text of the file. The elements are printed like
+   * write() would store them, so the file looks the same as after saveFile().
+   */
+  class StreamPrinter {
+   public:
+    /*!
+     * @brief Prints a stored entry unchanged.
+     * @param xml_element Valid pointer to an element of the document.
+     */
+    void copy(const XMLElement* xml_element) { xml_element->Accept(&printer); }
+
+    /*!
+     * @brief Prints the element of the variable.
+     * @param name The name of the variable.
+     * @param values Pointer to the variable or begin of the array.
+     * @param size The size of the array (1 if no array).
+     */
+    template <class T>
+    void write(const std::string& name, const T* values, int size) {
+      printer.OpenElement(name.c_str());
+      if constexpr (CharconvNumber<T> && Encoding == NumericArrayEncoding::Packed) {
+        if (size > 1) {
+          printPacked(std::span<const T>(values, static_cast<size_t>(size)));
+          printer.CloseElement();
+          return;
+        }
+      }
+      if (size > 1) {
+        for (int i = 0; i < size; ++i) {
+          printer.OpenElement(getChildName(i).c_str());
+          printValue(values[i]);
+          printer.CloseElement();
+        }
+      } else {
+        printValue(*values);
+      }
+      printer.CloseElement();
+    }
+
+    /*!
+     * @return The printed text.
+     */
+    [[nodiscard]] std::string_view text() const {
+      return std::string_view(printer.CStr(), static_cast<size_t>(printer.CStrSize() - 1));
+    }
+
+   private:
+    friend class BasicXmlCodec;
+
+    template <CharconvNumber T>
+    void printPacked(std::span<const T> values) {
+      printer.PushAttribute(COUNT_ATTRIBUTE, static_cast<uint64_t>(values.size()));
+      if (values.empty()) {
+        return;
+      }
+      packed_text.clear();
+      appendNumbers(values, packed_text);
+      printer.PushText(packed_text.c_str());
+    }
+
+    /// <Printing methodes>
+    /// <TYPE_SUPPORT> Print your type like it is saved (see savePrimitive())
+
+    void printText(const char char_data) { printer.PushText(std::string(1, char_data).c_str()); }
+
+    void printText(const wchar_t wchar_data) {
+      printer.PushText(castFromWstring(std::wstring(1, wchar_data)).c_str());
+    }
+
+    void printText(const std::wstring& wstring_data) {
+      printer.PushText(castFromWstring(wstring_data).c_str());
+    }
+
+    void printText(const std::string& string_data) { printer.PushText(string_data.c_str()); }
+
+    template <CharconvNumber T>
+    void printText(const T number_data) {
+      NumberBuffer buffer;
+      printer.PushText(formatNumber(number_data, buffer));
+    }
+
+    template <class T>
+    void printText(const T t_data) {
+      printer.PushText(t_data);
+    }
+
+    template <class T>
+    void printValue(const T& value) {
+      printText(value);
+    }
+
+    template <class Container>
+    void printContainer(const Container& container) {
+      using T = typename Container::value_type;
+      if constexpr (std::same_as<Container, std::vector<T>> && CharconvNumber<T> &&
+                    Encoding == NumericArrayEncoding::Packed) {
+        printPacked(std::span<const T>(container));
+      } else {
+        int i = 0;
+        for (const auto& d : container) {
+          printer.OpenElement(getChildName(i++).c_str());
+          printText(d);
+          printer.CloseElement();
+        }
+      }
+    }
+
+    template <class Container>
+    void printMap(const Container& container) {
+      int i = 0;
+      for (const auto& [key, value] : container) {
+        printer.OpenElement(getChildName(i++).c_str());
+        printText(key);
+        printer.OpenElement(getChildName(0).c_str());
+        printText(value);
+        printer.CloseElement();
+        printer.CloseElement();
+      }
+    }
+
+    template <class T>
+    void printValue(const std::vector<T>& value) {
+      printContainer(value);
+    }
+
+    template <class T>
+    void printValue(const std::list<T>& value) {
+      printContainer(value);
+    }
+
+    template <class T>
+    void printValue(const std::set<T>& value) {
+      printContainer(value);
+    }
+
+    template <class T>
+    void printValue(const std::multiset<T>& value) {
+      printContainer(value);
+    }
+
+    template <class T>
+    void printValue(const std::unordered_set<T>& value) {
+      printContainer(value);
+    }
+
+    template <class T1, class T2>
+    void printValue(const std::map<T1, T2>& value) {
+      printMap(value);
+    }
+
+    template <class T1, class T2>
+    void printValue(const std::multimap<T1, T2>& value) {
+      printMap(value);
+    }
+
+    template <class T1, class T2>
+    void printValue(const std::unordered_map<T1, T2>& value) {
+      printMap(value);
+    }
+
+    template <class T1, class T2>
+    void printValue(const std::unordered_multimap<T1, T2>& value) {
+      printMap(value);
+    }
+
+    template <class T1, class T2>
+    void printValue(const std::pair<T1, T2>& value) {
+      printer.OpenElement(getChildName(0).c_str());
+      printText(value.first);
+      printer.CloseElement();
+      printer.OpenElement(getChildName(1).c_str());
+      printText(value.second);
+      printer.CloseElement();
+    }
+
+    /// </Printing methodes>
+
+    tinyxml2::XMLPrinter printer;
+    // Reused for the text of packed arrays.
+    std::string packed_text;
+  };
+
+  /*!
+   * @brief Prints the document like saveFile(), but the entries inside the
+   * root element are printed by print_entries instead of from the document.
+   * Nodes outside the root element (declaration, comments) and the
+   * attributes of the root are taken from the document. The document is not
+   * changed.
+   * @param printer Receives the text.
+   * @param print_entries Callable void(StreamPrinter&) which prints all entries.
+   */
+  template <class PrintEntries>
+  void printStreaming(StreamPrinter& printer, PrintEntries&& print_entries) const {
+    tinyxml2::XMLPrinter& xml_printer = printer.printer;
+    if (settingsDocument.HasBOM()) {
+      xml_printer.PushHeader(true, false);
+    }
+    const tinyxml2::XMLNode* node = settingsDocument.FirstChild();
+    for (; node != nullptr && node != settings; node = node->NextSibling()) {
+      node->Accept(&xml_printer);
+    }
+
+    const XMLElement* root = settings->ToElement();
+    xml_printer.OpenElement(root->Name());
+    for (const tinyxml2::XMLAttribute* attribute = root->FirstAttribute(); attribute != nullptr;
+         attribute = attribute->Next()) {
+      xml_printer.PushAttribute(attribute->Name(), attribute->Value());
+    }
+    std::forward<PrintEntries>(print_entries)(printer);
+    xml_printer.CloseElement();
+
+    for (node = node == nullptr ? nullptr : node->NextSibling(); node != nullptr;
+         node = node->NextSibling()) {
+      node->Accept(&xml_printer);
+    }
+  }
+
+ private:
+  [[nodiscard]] static CodecStatus toStatus(XMLError error) {
+    switch (error) {
+      case XMLError::XML_SUCCESS:
+        return CodecStatus::Ok;
+      case XMLError::XML_NO_TEXT_NODE:
+        return CodecStatus::NoValue;
+      default:
+        return CodecStatus::Invalid;
+    }
+  }
+
+  /*!
+   * @brief Parse the xml file from a read-only mapping. The mapping is
+   * released as soon as the document is parsed.
+   * @return The XMLError as XMLDocument::LoadFile() would report it, or nothing if the file can not be mapped.
+   */
+  [[nodiscard]] std::optional<XMLError> loadMappedFile(const std::filesystem::path& source) {
+    const MappedFile mapped_file(source);
+    switch (mapped_file.status()) {
+      case MappedFile::Status::Ok:
+        return settingsDocument.Parse(mapped_file.data(), mapped_file.size());
+      case MappedFile::Status::NotFound:
+        return XMLError::XML_ERROR_FILE_NOT_FOUND;
+      case MappedFile::Status::CouldNotOpen:
+        return XMLError::XML_ERROR_FILE_COULD_NOT_BE_OPENED;
+      case MappedFile::Status::Empty:
+        return XMLError::XML_ERROR_EMPTY_DOCUMENT;
+      case MappedFile::Status::NotMappable:
+        break;
+    }
+    return std::nullopt;
+  }
+
+  /*!
+   * @brief After loading the document from file or cache, find the root.
+   * @param error After loading the document.
+   * @return The matching DocumentStatus.
+   */
+  [[nodiscard]] DocumentStatus prepareDocumentAfterLoad(XMLError error) {
+    last_error = error;
+    settings   = nullptr;
+    switch (error) {
+      case XMLError::XML_SUCCESS:
+        // The first child might be the declaration or a comment.
+        settings = settingsDocument.RootElement();
+        return settings == nullptr ? DocumentStatus::ReadError : DocumentStatus::Ok;
+      case XMLError::XML_ERROR_FILE_NOT_FOUND:
+        return DocumentStatus::NotFound;
+      case XMLError::XML_ERROR_EMPTY_DOCUMENT:
+        return DocumentStatus::Empty;
+      case XMLError::XML_ERROR_FILE_COULD_NOT_BE_OPENED:
+        return DocumentStatus::CouldNotOpen;
+      case XMLError::XML_ERROR_FILE_READ_ERROR:
+        return DocumentStatus::ReadError;
+      default:
+        return DocumentStatus::ParseError;
+    }
+  }
+
+  /*!
+   * @brief get the name of child nodes (array entry)
+   * @param i position in array.
+   * return name of child node
+   */
+  std::string static getChildName(int i) {
+    return std::string("_" + std::to_string(i));
+  }
+
+  /*!
+   * @brief Checks if the element is named like the child node at position i
+   * (see getChildName()) without building the name.
+   * @param child Valid pointer to the element to check.
+   * @param i position in array.
+   * return true if the name is "_<i>".
+   */
+  [[nodiscard]] static bool isChildName(const XMLElement* child, size_t i) {
+    const std::string_view name(child->Name());
+    if (name.size() < 2 || name[0] != '_' || (name[1] == '0' && name.size() != 2)) {
+      return false;
+    }
+    size_t position = 0;
+    const auto [end, error] =
+      std::from_chars(name.data() + 1, name.data() + name.size(), position);
+    return error == std::errc() && end == name.data() + name.size() && position == i;
+  }
+
+  /*!
+   * @brief Returns the i-th child node following the given child node, if it
+   * is named correctly.
+   * @param child The (i-1)th child node or nullptr.
+   * @param i position in array of the requested child.
+   * return the next sibling element, or nullptr if there is none or it is not named "_<i>".
+   */
+  [[nodiscard]] static const XMLElement* nextChild(const XMLElement* child, size_t i) {
+    const XMLElement* next = child->NextSiblingElement();
+    if (next == nullptr || !isChildName(next, i)) {
+      return nullptr;
+    }
+    return next;
+  }
+
+  /*!
+   * @brief Counts the child nodes "_0", "_1", ... of the given element by
+   * walking the siblings once.
+   * @param xml_element Valid pointer to the parent element.
+   * @param child_count Set to the number of children found.
+   * return XML_SUCCESS or XML_ERROR_PARSING if a child element is not named
+   * after its position.
+   */
+  [[nodiscard]] static XMLError countChildren(const XMLElement* xml_element, size_t& child_count) {
+    child_count = 0;
+    for (const XMLElement* child = xml_element->FirstChildElement(); child != nullptr;
+         child = child->NextSiblingElement()) {
+      if (!isChildName(child, child_count)) {
+        return XMLError::XML_ERROR_PARSING;
+      }
+      ++child_count;
+    }
+    return XMLError::XML_SUCCESS;
+  }
+
+  static constexpr const char* COUNT_ATTRIBUTE = "count";
+
+  /*!
+   * @brief Checks if the element holds packed numbers (see NumericArrayEncoding::Packed).
+   * @param xml_element Valid pointer to the element.
+   * return true if the element has a count attribute and no child elements.
+   */
+  [[nodiscard]] static bool isPacked(const XMLElement* xml_element) {
+    return xml_element->Attribute(COUNT_ATTRIBUTE) != nullptr &&
+           xml_element->FirstChildElement() == nullptr;
+  }
+
+  /*!
+   * @brief Reads the count attribute of a packed element.
+   * @param xml_element Valid pointer to a packed element.
+   * @param count Set to the number of stored numbers.
+   * return XML_SUCCESS or XML_ERROR_PARSING if the count can not be right.
+   */
+  [[nodiscard]] static XMLError packedCount(const XMLElement* xml_element, size_t& count) {
+    uint64_t stored_count = 0;
+    if (xml_element->QueryUnsigned64Attribute(COUNT_ATTRIBUTE, &stored_count) !=
+        XMLError::XML_SUCCESS) {
+      return XMLError::XML_ERROR_PARSING;
+    }
+    // every number needs at least one character, do not trust larger counts.
+    const char* text = xml_element->GetText();
+    if (stored_count > std::string_view(text == nullptr ? "" : text).size()) {
+      return XMLError::XML_ERROR_PARSING;
+    }
+    count = static_cast<size_t>(stored_count);
+    return XMLError::XML_SUCCESS;
+  }
+
+  /*!
+   * @brief Loads packed numbers into values.
+   * @param xml_element Valid pointer to a packed element.
+   * @param values Receives the numbers, the count attribute must match its size.
+   * return XMLError errorflag showing if parsing was successfull.
+   */
+  template <CharconvNumber T>
+  [[nodiscard]] static XMLError loadPacked(const XMLElement* xml_element, std::span<T> values) {
+    size_t count         = 0;
+    const XMLError error = packedCount(xml_element, count);
+    if (error != XMLError::XML_SUCCESS) {
+      return error;
+    }
+    if (count != values.size()) {
+      return XMLError::XML_ERROR_PARSING;
+    }
+    const char* text = xml_element->GetText();
+    return parseNumbers(text == nullptr ? "" : text, values) ? XMLError::XML_SUCCESS
+                                                             : XMLError::XML_CAN_NOT_CONVERT_TEXT;
+  }
+
+  /*!
+   * @brief Stores the numbers packed into the text of one element.
+   * @param xml_element Valid pointer to the element which stores the numbers.
+   * @param values The numbers to store.
+   */
+  template <CharconvNumber T>
+  static void savePacked(XMLElement* xml_element, std::span<const T> values) {
+    xml_element->DeleteChildren();
+    xml_element->SetAttribute(COUNT_ATTRIBUTE, static_cast<uint64_t>(values.size()));
+    if (values.empty()) {
+      return;
+    }
+    std::string text;
+    appendNumbers(values, text);
+    xml_element->SetText(text.c_str());
+  }
+
+  /// <Loading methodes>
+
+  /*!
+   * @brief Loads a stored number into the member variable using
+   * std::from_chars (locale independent, the whole text must be the number).
+   * @param xml_element Valid pointer to the element which stores the variable.
+   * @param number_data Pointer to the number to be written.
+   * return XMLError errorflag showing if parsing was successfull.
+   */
+  template <CharconvNumber T>
+  [[nodiscard]] static XMLError loadNumber(const XMLElement* xml_element, T* number_data) {
+    const char* text = xml_element->GetText();
+    if (text == nullptr) {
+      return XMLError::XML_NO_TEXT_NODE;
+    }
+    return parseNumber(text, *number_data) ? XMLError::XML_SUCCESS
+                                           : XMLError::XML_CAN_NOT_CONVERT_TEXT;
+  }
+
+  // <TYPE_SUPPORT> Define your own loadYourType methode which loads your Type
+  // from XML into the pointer
+
+  /*!
+   * @brief Loads stored bool value into member variable.
+   * @param xml_element Valid pointer to the element which stores the variable.
+   * @param bool_data bool pointer to member variable or begin of array.
+   * @param increment Position in member variable array, or 0 if not array but
+   * simple member variable. return XMLError errorflag showing if parsing was
+   * successfull.
+   */
+  [[nodiscard]] XMLError loadData(const XMLElement* xml_element, bool* bool_data, int increment) {
+    return xml_element->QueryBoolText(bool_data + increment);
+  }
+
+  /*!
+   * @brief Loads stored int value into member variable.
+   * @param xml_element Valid pointer to the element which stores the variable.
+   * @param int_data int pointer to member variable or begin of array.
+   * @param increment Position in member variable array, or 0 if not array but
+   * simple member variable. return XMLError errorflag showing if parsing was
+   * successfull.
+   */
+  [[nodiscard]] XMLError loadData(const XMLElement* xml_element, int* int_data, int increment) {
+    return loadNumber(xml_element, int_data + increment);
+  }
+
+  /*!
+   * @brief Loads stored int64_t value into member variable.
+   * @param xml_element Valid pointer to the element which stores the variable.
+   * @param int64_data int64_t pointer to member variable or begin of array.
+   * @param increment Position in member variable array, or 0 if not array but
+   * simple member variable. return XMLError errorflag showing if parsing was
+   * successfull.
+   */
+  [[nodiscard]] XMLError loadData(const XMLElement* xml_element, int64_t* int64_data, int increment) {
+    return loadNumber(xml_element, int64_data + increment);
+  }
+
+  /*!
+   * @brief Loads stored unsigned int value into member variable.
+   * @param xml_element Valid pointer to the element which stores the variable.
+   * @param unsigned_data unsigned int pointer to member variable or begin of
+   * array. @param increment Position in member variable array, or 0 if not
+   * array but simple member variable. return XMLError errorflag showing if
+   * parsing was successfull.
+   */
+  [[nodiscard]] XMLError loadData(const XMLElement* xml_element,
+                                  unsigned int* unsigned_data,
+                                  int increment) {
+    return loadNumber(xml_element, unsigned_data + increment);
+  }
+
+  /*!
+   * @brief Loads stored uint64_t value into member variable.
+   * @param xml_element Valid pointer to the element which stores the variable.
+   * @param uint64_data uint64_t pointer to member variable or begin of array.
+   * @param increment Position in member variable array, or 0 if not array but
+   * simple member variable. return XMLError errorflag showing if parsing was
+   * successfull.
+   */
+  [[nodiscard]] XMLError loadData(const XMLElement* xml_element, uint64_t* uint64_data, int increment) {
+    return loadNumber(xml_element, uint64_data + increment);
+  }
+
+
+  /*!
+   * @brief Loads stored float value into member variable.
+   * @param xml_element Valid pointer to the element which stores the variable.
+   * @param float_data float pointer to member variable or begin of array.
+   * @param increment Position in member variable array, or 0 if not array but
+   * simple member variable. return XMLError errorflag showing if parsing was
+   * successfull.
+   */
+  [[nodiscard]] XMLError loadData(const XMLElement* xml_element, float* float_data, int increment) {
+    return loadNumber(xml_element, float_data + increment);
+  }
+
+  /*!
+   * @brief Loads stored double value into member variable.
+   * @param xml_element Valid pointer to the element which stores the variable.
+   * @param double_data double pointer to member variable or begin of array.
+   * @param increment Position in member variable array, or 0 if not array but
+   * simple member variable. return XMLError errorflag showing if parsing was
+   * successfull.
+   */
+  [[nodiscard]] XMLError loadData(const XMLElement* xml_element, double* double_data, int increment) {
+    return loadNumber(xml_element, double_data + increment);
+  }
+
+  /*!
+   * @brief Loads stored string value into member variable.
+   * @param xml_element Valid pointer to the element which stores the variable.
+   * @param string_data string pointer to member variable or begin of array.
+   * @param increment Position in member variable array, or 0 if not array but
+   * simple member variable. return XMLError errorflag showing if parsing was
+   * successfull.
+   */
+  [[nodiscard]] XMLError loadData(const XMLElement* xml_element,
+                                  std::string* string_data,
+                                  int increment) {
+    return xml_element->QueryStrText(string_data + increment);
+  }
+
+  /*!
+   * @brief Loads stored wstring value into member variable.
+   * @param xml_element Valid pointer to the element which stores the variable.
+   * @param wstring_data wstring pointer to member variable or begin of array.
+   * @param increment Position in member variable array, or 0 if not array but
+   * simple member variable. return XMLError errorflag showing if parsing was
+   * successfull.
+   */
+  [[nodiscard]] XMLError loadData(const XMLElement* xml_element,
+                                  std::wstring* wstring_data,
+                                  int increment) {
+    std::string s;
+    const XMLError retVal = xml_element->QueryStrText(&s);
+    if (retVal == XMLError::XML_SUCCESS) {
+      *(wstring_data + increment) = castToWstring(s);
+    }
+    return retVal;
+  }
+
+  /*!
+   * @brief Loads stored char value into member variable.
+   * @param xml_element Valid pointer to the element which stores the variable.
+   * @param char_data char pointer to member variable or begin of array.
+   * @param increment Position in member variable array, or 0 if not array but
+   * simple member variable. return XMLError errorflag showing if parsing was
+   * successfull.
+   */
+  [[nodiscard]] XMLError loadData(const XMLElement* xml_element, char* char_data, int increment) {
+    std::string temp;
+    const XMLError error = xml_element->QueryStrText(&temp);
+    if (error != XMLError::XML_SUCCESS) {
+      return error;
+    }
+    assert(temp.size() == 1);
+    if (temp.size() != 1) {
+      return XMLError::XML_CAN_NOT_CONVERT_TEXT;
+    }
+    *(char_data + increment) = temp[0];
+    return error;
+  }
+
+  /*!
+   * @brief Loads stored wchar_t value into member variable.
+   * @param xml_element Valid pointer to the element which stores the variable.
+   * @param wchar_data wchar_t pointer to member variable or begin of array.
+   * @param increment Position in member variable array, or 0 if not array but
+   * simple member variable. return XMLError errorflag showing if parsing was
+   * successfull.
+   */
+  [[nodiscard]] XMLError loadData(const XMLElement* xml_element, wchar_t* wchar_data, int increment) {
+    std::string temp;
+    const XMLError error = xml_element->QueryStrText(&temp);
+    if (error != XMLError::XML_SUCCESS) {
+      return error;
+    }
+    assert(temp.size() <= 2);
+    if (temp.size() > 2) {
+      return XMLError::XML_CAN_NOT_CONVERT_TEXT;
+    }
+    const std::wstring wtemp = castToWstring(temp);
+    assert(wtemp.size() == 1);
+    if (wtemp.size() != 1) {
+      return XMLError::XML_CAN_NOT_CONVERT_TEXT;
+    }
+    *(wchar_data + increment) = wtemp[0];
+    return error;
+  }
+
+
+  /*!
+   * @brief Loads stored vector data into member variable.
+   * @param xml_element Valid pointer to the element which stores the variable.
+   * @param data_ptr vector like pointer to member variable or begin of array.
+   * @param increment Position in member variable array, or 0 if not array but
+   * simple member variable. return XMLError errorflag showing if parsing was
+   * successfull.
+   */
+  template <class VectorContainer>
+  [[nodiscard]] XMLError loadVectorData(const XMLElement* xml_element,
+                                        VectorContainer* data_ptr,
+                                        int increment) {
+    std::advance(data_ptr, increment);
+
+    if constexpr (std::same_as<VectorContainer, std::vector<typename VectorContainer::value_type>> &&
+                  CharconvNumber<typename VectorContainer::value_type>) {
+      if (isPacked(xml_element)) {
+        size_t count         = 0;
+        const XMLError error = packedCount(xml_element, count);
+        if (error != XMLError::XML_SUCCESS) {
+          return error;
+        }
+        data_ptr->resize(count);
+        return loadPacked(xml_element, std::span(*data_ptr));
+      }
+    }
+
+    size_t child_count = 0;
+    const XMLError count_error = countChildren(xml_element, child_count);
+    if (count_error != XMLError::XML_SUCCESS) {
+      return count_error;
+    }
+    data_ptr->resize(child_count);
+
+    // countChildren() made sure the children are named correctly.
+    const XMLElement* child = xml_element->FirstChildElement();
+    for (auto it = data_ptr->begin(); it != data_ptr->end(); ++it) {
+      XMLError error = loadData(child, &(*it), 0);
+      if (error != XMLError::XML_SUCCESS) {
+        return error;
+      }
+      child = child->NextSiblingElement();
+    }
+    return XMLError::XML_SUCCESS;
+  }
+
+  template <class T>
+  [[nodiscard]] XMLError loadData(const XMLElement* xml_element,
+                                  std::vector<T>* data_ptr,
+                                  int increment) {
+    return loadVectorData(xml_element, data_ptr, increment);
+  }
+
+
+  template <class T>
+  [[nodiscard]] XMLError loadData(const XMLElement* xml_element, std::list<T>* data_ptr, int increment) {
+    return loadVectorData(xml_element, data_ptr, increment);
+  }
+
+  /*!
+   * @brief Loads stored set data into member variable.
+   * @param xml_element Valid pointer to the element which stores the variable.
+   * @param data_ptr set like pointer to member variable or begin of array.
+   * @param increment Position in member variable array, or 0 if not array but
+   * simple member variable. return XMLError errorflag showing if parsing was
+   * successfull.
+   */
+  template <template <typename> class SetContainer, typename T>
+  [[nodiscard]] XMLError loadSetData(const XMLElement* xml_element,
+                                     SetContainer<T>* data_ptr,
+                                     int increment) {
+    std::advance(data_ptr, increment);
+
+    size_t i = 0;
+    data_ptr->clear();
+    auto insertion_hint = data_ptr->begin();
+    for (const XMLElement* child = xml_element->FirstChildElement(); child != nullptr;
+         child = child->NextSiblingElement()) {
+      if (!isChildName(child, i++)) {
+        return XMLError::XML_ERROR_PARSING;
+      }
+      T temp;
+      XMLError error = loadData(child, &temp, 0);
+      if (error != XMLError::XML_SUCCESS) {
+        return error;
+      }
+      insertion_hint = data_ptr->insert(insertion_hint, temp);
+    }
+
+    return XMLError::XML_SUCCESS;
+  }
+
+  template <class T>
+  [[nodiscard]] XMLError loadData(const XMLElement* xml_element, std::set<T>* data_ptr, int increment) {
+    return loadSetData(xml_element, data_ptr, increment);
+  }
+
+  template <class T>
+  [[nodiscard]] XMLError loadData(const XMLElement* xml_element,
+                                  std::multiset<T>* data_ptr,
+                                  int increment) {
+    return loadSetData(xml_element, data_ptr, increment);
+  }
+
+  template <class T>
+  [[nodiscard]] XMLError loadData(const XMLElement* xml_element,
+                                  std::unordered_set<T>* data_ptr,
+                                  int increment) {
+    return loadSetData(xml_element, data_ptr, increment);
+  }
+
+  /*!
+   * @brief Loads stored map data into member variable.
+   * @param xml_element Valid pointer to the element which stores the variable.
+   * @param data_ptr map like pointer to member variable or begin of array.
+   * @param increment Position in member variable array, or 0 if not array but
+   * simple member variable. return XMLError errorflag showing if parsing was
+   * successfull.
+   */
+  template <template <typename, typename> class MapContainer, typename T1, typename T2>
+  [[nodiscard]] XMLError loadMapData(const XMLElement* xml_element,
+                                     MapContainer<T1, T2>* data_ptr,
+                                     int increment) {
+    std::advance(data_ptr, increment);
+
+    size_t i = 0;
+    data_ptr->clear();
+    auto insertion_hint = data_ptr->begin();
+
+    for (const XMLElement* childKey = xml_element->FirstChildElement(); childKey != nullptr;
+         childKey = childKey->NextSiblingElement()) {
+      if (!isChildName(childKey, i++)) {
+        return XMLError::XML_ERROR_PARSING;
+      }
+      T1 key;
+      XMLError error = loadData(childKey, &key, 0);
+      if (error != XMLError::XML_SUCCESS) {
+        return error;
+      }
+      // the value is the only child of the key, named "_0"
+      const XMLElement* childValue = childKey->FirstChildElement();
+      if (childValue == nullptr || !isChildName(childValue, 0)) {
+        return XMLError::XML_ERROR_PARSING;
+      }
+      T2 value;
+      error = loadData(childValue, &value, 0);
+      if (error != XMLError::XML_SUCCESS) {
+        return error;
+      }
+      insertion_hint = data_ptr->insert(insertion_hint, {key, value});
+    }
+
+    return XMLError::XML_SUCCESS;
+  }
+
+  template <class T1, class T2>
+  [[nodiscard]] XMLError loadData(const XMLElement* xml_element,
+                                  std::map<T1, T2>* data_ptr,
+                                  int increment) {
+    return loadMapData(xml_element, data_ptr, increment);
+  }
+  template <class T1, class T2>
+  [[nodiscard]] XMLError loadData(const XMLElement* xml_element,
+                                  std::multimap<T1, T2>* data_ptr,
+                                  int increment) {
+    return loadMapData(xml_element, data_ptr, increment);
+  }
+
+  template <class T1, class T2>
+  [[nodiscard]] XMLError loadData(const XMLElement* xml_element,
+                                  std::unordered_map<T1, T2>* data_ptr,
+                                  int increment) {
+    return loadMapData(xml_element, data_ptr, increment);
+  }
+
+  template <class T1, class T2>
+  [[nodiscard]] XMLError loadData(const XMLElement* xml_element,
+                                  std::unordered_multimap<T1, T2>* data_ptr,
+                                  int increment) {
+    return loadMapData(xml_element, data_ptr, increment);
+  }
+
+  /*!
+   * @brief Loads stored std::pair data into member variable.
+   * @param xml_element Valid pointer to the element which stores the variable.
+   * @param data_ptr std::pair pointer to member variable or begin of array.
+   * @param increment Position in member variable array, or 0 if not array but
+   * simple member variable. return XMLError errorflag showing if parsing was
+   * successfull.
+   */
+  template <class T1, class T2>
+  [[nodiscard]] XMLError loadData(const XMLElement* xml_element,
+                                  std::pair<T1, T2>* data_ptr,
+                                  int increment) {
+    std::advance(data_ptr, increment);
+
+    const XMLElement* childFirst = xml_element->FirstChildElement();
+    if (childFirst == nullptr || !isChildName(childFirst, 0)) {
+      return XMLError::XML_ERROR_PARSING;
+    }
+    const XMLElement* childSecond = nextChild(childFirst, 1);
+
+    if (childSecond == nullptr) {
+      return XMLError::XML_ERROR_PARSING;
+    }
+    XMLError error = loadData(childFirst, &(data_ptr->first), 0);
+    if (error != XMLError::XML_SUCCESS) {
+      return error;
+    }
+    error = loadData(childSecond, &(data_ptr->second), 0);
+    if (error != XMLError::XML_SUCCESS) {
+      return error;
+    }
+    return XMLError::XML_SUCCESS;
+  }
+
+
+
+  /// </Loading methodes>
+
+  /// <Saving methodes>
+  /// <TYPE_SUPPORT> You need to define how your type should be stored
+
+  void setText(XMLElement* xml_element, const char char_data) {
+    // tinyXml does not support char, cast to std::string
+    std::string tmp(1, char_data);
+    xml_element->SetText(tmp);
+  }
+
+  void setText(XMLElement* xml_element, const wchar_t wchar_data) {
+    std::wstring tmp(1, wchar_data);
+    std::string stmp = castFromWstring(tmp);
+    xml_element->SetText(stmp);
+  }
+
+  void setText(XMLElement* xml_element, const std::wstring& wchar_data) {
+    std::string stmp = castFromWstring(wchar_data);
+    xml_element->SetText(stmp);
+  }
+
+  void setText(XMLElement* xml_element, const std::string& string_data) {
+    // this is just so that we dont copy the string twice (SetText takes a copy) the templated version does too since the basic types are smaller than a reference pointer.
+    xml_element->SetText(string_data);
+  }
+
+  template <CharconvNumber T>
+  void setText(XMLElement* xml_element, const T number_data) {
+    // shortest round trip representation, independent of the global locale.
+    NumberBuffer buffer;
+    xml_element->SetText(formatNumber(number_data, buffer));
+  }
+
+  template <class T>
+  void setText(XMLElement* xml_element, const T t_data) {
+    xml_element->SetText(t_data);
+  }
+  /*!
+   * @brief Stores the value of a member variable with basic type T.
+   * \tparam T Type of the to be stored variable
+   * @param xml_element Valid pointer to the element which stores the variable.
+   * @param data_ptr The Pointer to the Data to be stored
+   * @param int The size of the possible array (1 if no array)
+   */
+  template <class T>
+  void savePrimitive(XMLElement* xml_element, T data_ptr, int size) {
+    if (size > 1) {
+      xml_element->DeleteAttribute(COUNT_ATTRIBUTE);
+      xml_element->DeleteChildren();
+      for (int i = 0; i < size; ++i) {
+        XMLElement* child = xml_element->InsertNewChildElement(getChildName(i).c_str());
+        setText(child, *data_ptr++);
+        xml_element->InsertEndChild(child);
+      }
+    } else {
+      setText(xml_element, *data_ptr);
+    }
+  }
+
+  /*!
+   * @brief Stores the value of a member variable with StlContainer type Container<T>.
+   * \tparam T Type of the to be stored variable
+   * @param xml_element Valid pointer to the element which stores the variable.
+   * @param data_ptr The Pointer to the Data  container to be stored
+   * @param int The size of the possible array (1 if no array)
+   */
+  template <typename Container>
+  void saveContainer(XMLElement* xml_element, Container* data_ptr, int size) {
+
+    auto save1Container = [this](XMLElement* parent, Container* data_ptr_lambda) {
+      using T = typename Container::value_type;
+      if constexpr (std::same_as<Container, std::vector<T>> && CharconvNumber<T>) {
+        if constexpr (Encoding == NumericArrayEncoding::Packed) {
+          savePacked(parent, std::span<const T>(*data_ptr_lambda));
+          return;
+        }
+        parent->DeleteAttribute(COUNT_ATTRIBUTE);
+      }
+      parent->DeleteChildren();
+      int i = 0;
+      for (const auto& d : *data_ptr_lambda) {
+        XMLElement* child = parent->InsertNewChildElement(getChildName(i++).c_str());
+        this->setText(child, d);
+        parent->InsertEndChild(child);
+      }
+    };
+
+    if (size > 1) {
+      xml_element->DeleteChildren();
+      for (int i = 0; i < size; ++i) {
+        XMLElement* child = xml_element->InsertNewChildElement(getChildName(i).c_str());
+        save1Container(child, data_ptr++);
+        xml_element->InsertEndChild(child);
+      }
+
+    } else {
+      save1Container(xml_element, data_ptr);
+    }
+  }
+
+  /*!
+   * @brief Stores the value of a member variable with StlContainer type Container<T1, T2>.
+   * \tparam T Type of the to be stored variable
+   * @param xml_element Valid pointer to the element which stores the variable.
+   * @param data_ptr The Pointer to the Data  container to be stored
+   * @param int The size of the possible array (1 if no array)
+   */
+  template <typename Container>
+  void saveMap(XMLElement* xml_element, Container* data_ptr, int size) {
+
+    auto save1Container = [this](XMLElement* parent, Container* data_ptr_lambda) {
+      parent->DeleteChildren();
+      int i = 0;
+      for (const auto& [key, value] : *data_ptr_lambda) {
+        XMLElement* child = parent->InsertNewChildElement(getChildName(i++).c_str());
+        this->setText(child, key);
+        XMLElement* childValue = child->InsertNewChildElement(getChildName(0).c_str());
+        this->setText(childValue, value);
+        child->InsertEndChild(childValue);
+        parent->InsertEndChild(child);
+      }
+    };
+
+    if (size > 1) {
+      xml_element->DeleteChildren();
+      for (int i = 0; i < size; ++i) {
+        XMLElement* child = xml_element->InsertNewChildElement(getChildName(i).c_str());
+        save1Container(child, data_ptr++);
+        xml_element->InsertEndChild(child);
+      }
+
+    } else {
+      save1Container(xml_element, data_ptr);
+    }
+  }
+
+  template <class T>
+  void savePrimitive(XMLElement* xml_element, std::vector<T>* data_ptr, int size) {
+    saveContainer(xml_element, data_ptr, size);
+  }
+
+  template <class T>
+  void savePrimitive(XMLElement* xml_element, std::list<T>* data_ptr, int size) {
+    saveContainer(xml_element, data_ptr, size);
+  }
+
+  template <class T>
+  void savePrimitive(XMLElement* xml_element, std::set<T>* data_ptr, int size) {
+    saveContainer(xml_element, data_ptr, size);
+  }
+
+  template <class T>
+  void savePrimitive(XMLElement* xml_element, std::multiset<T>* data_ptr, int size) {
+    saveContainer(xml_element, data_ptr, size);
+  }
+
+  template <class T>
+  void savePrimitive(XMLElement* xml_element, std::unordered_set<T>* data_ptr, int size) {
+    saveContainer(xml_element, data_ptr, size);
+  }
+
+  template <class T1, class T2>
+  void savePrimitive(XMLElement* xml_element, std::map<T1, T2>* data_ptr, int size) {
+    saveMap(xml_element, data_ptr, size);
+  }
+  template <class T1, class T2>
+  void savePrimitive(XMLElement* xml_element, std::multimap<T1, T2>* data_ptr, int size) {
+    saveMap(xml_element, data_ptr, size);
+  }
+
+  template <class T1, class T2>
+  void savePrimitive(XMLElement* xml_element, std::unordered_map<T1, T2>* data_ptr, int size) {
+    saveMap(xml_element, data_ptr, size);
+  }
+
+  template <class T1, class T2>
+  void savePrimitive(XMLElement* xml_element, std::unordered_multimap<T1, T2>* data_ptr, int size) {
+    saveMap(xml_element, data_ptr, size);
+  }
+
+  /*!
+   * @brief Stores the value of a member variable with std::pair type Container<T1, T2>.
+   * \tparam T Type of the to be stored variable
+   * @param xml_element Valid pointer to the element which stores the variable.
+   * @param data_ptr The Pointer to the Data  container to be stored
+   * @param int The size of the possible array (1 if no array)
+   */
+  template <class T1, class T2>
+  void savePrimitive(XMLElement* xml_element, std::pair<T1, T2>* data_ptr, int size) {
+    auto save1Container = [this](XMLElement* parent, std::pair<T1, T2>* data_ptr_lambda) {
+      parent->DeleteChildren();
+
+      XMLElement* childFirst = parent->InsertNewChildElement(getChildName(0).c_str());
+      this->setText(childFirst, data_ptr_lambda->first);
+      parent->InsertEndChild(childFirst);
+      XMLElement* childSecond = parent->InsertNewChildElement(getChildName(1).c_str());
+      this->setText(childSecond, data_ptr_lambda->second);
+      parent->InsertEndChild(childSecond);
+    };
+
+    if (size > 1) {
+      xml_element->DeleteChildren();
+      for (int i = 0; i < size; ++i) {
+        XMLElement* child = xml_element->InsertNewChildElement(getChildName(i).c_str());
+        save1Container(child, data_ptr++);
+        xml_element->InsertEndChild(child);
+      }
+
+    } else {
+      save1Container(xml_element, data_ptr);
+    }
+  }
+
+  /// </Saving methodes>
+
+  tinyxml2::XMLDocument settingsDocument;
+  tinyxml2::XMLNode* settings = nullptr;
+  XMLError last_error         = XMLError::XML_SUCCESS;
+};
+
+using XmlCodec       = BasicXmlCodec<NumericArrayEncoding::Elements>;
+using PackedXmlCodec = BasicXmlCodec<NumericArrayEncoding::Packed>;
+
+}  // namespace util
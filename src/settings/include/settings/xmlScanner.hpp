@@ -0,0 +1,145 @@
+/**
+ * @file xmlScanner.hpp
+ * @brief Contains the scanner which splits xml text into the elements below the root element without building a document.
+ *
+ * @date 16.10.2026
+ * @author Jakob Wandel
+ * @version 1.0
+ **/
+
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+namespace util {
+
+namespace detail {
+
+/**
+ * @brief Finds the end of a construct with a fixed terminator (comment,
+ * CDATA, processing instruction).
+ * @param xml The text.
+ * @param position Where to start searching.
+ * @param terminator The end of the construct, e.g. "-->".
+ * @return The position behind the terminator, or npos if it is missing.
+ **/
+[[nodiscard]] inline size_t skipPast(std::string_view xml, size_t position, std::string_view terminator) {
+  const size_t found = xml.find(terminator, position);
+  return found == std::string_view::npos ? found : found + terminator.size();
+}
+
+/**
+ * @brief Finds the '>' closing a tag. A '>' inside quoted attribute values
+ * or (for <!DOCTYPE) inside the brackets of the internal subset does not count.
+ * @param xml The text.
+ * @param position Behind the '<' of the tag.
+ * @return The position of the '>', or npos if it is missing.
+ **/
+[[nodiscard]] inline size_t tagEnd(std::string_view xml, size_t position) {
+  char quote   = 0;
+  int brackets = 0;
+  for (; position < xml.size(); ++position) {
+    const char c = xml[position];
+    if (quote != 0) {
+      if (c == quote) {
+        quote = 0;
+      }
+    } else if (c == '"' || c == '\'') {
+      quote = c;
+    } else if (c == '[') {
+      ++brackets;
+    } else if (c == ']') {
+      --brackets;
+    } else if (c == '>' && brackets <= 0) {
+      return position;
+    }
+  }
+  return std::string_view::npos;
+}
+
+}  // namespace detail
+
+/**
+ * @brief Walks the xml text once and hands every element directly below the
+ * root element to on_child, without parsing its content. Only the structure
+ * is checked: tags, comments, CDATA sections and processing instructions must
+ * be terminated and the root element must be closed. Names of end tags are
+ * not compared with their start tags, the caller parses the elements.
+ * @param xml The text.
+ * @param on_child Callable void(std::string_view name, std::string_view element)
+ * receiving the name and the whole text of the element (from its '<' to the
+ * '>' of its end tag). Both view into xml.
+ * @return false if the text is not structured like a document with one root
+ * element.
+ **/
+template <class OnChild>
+[[nodiscard]] bool scanTopLevelElements(std::string_view xml, OnChild&& on_child) {
+  constexpr size_t NPOS = std::string_view::npos;
+  int depth             = 0;
+  size_t child_begin    = 0;
+  std::string_view child_name;
+  size_t position = 0;
+  while ((position = xml.find('<', position)) != NPOS) {
+    const std::string_view tag = xml.substr(position);
+    size_t end                 = NPOS;
+    if (tag.starts_with("<?")) {
+      end = detail::skipPast(xml, position + 2, "?>");
+    } else if (tag.starts_with("<!--")) {
+      end = detail::skipPast(xml, position + 4, "-->");
+    } else if (tag.starts_with("<![CDATA[")) {
+      end = detail::skipPast(xml, position + 9, "]]>");
+    } else if (tag.starts_with("<!")) {
+      const size_t close = detail::tagEnd(xml, position + 2);
+      end                = close == NPOS ? NPOS : close + 1;
+    } else if (tag.starts_with("</")) {
+      const size_t close = xml.find('>', position);
+      if (close == NPOS || depth == 0) {
+        return false;
+      }
+      end = close + 1;
+      --depth;
+      if (depth == 0) {
+        // Only the tail (comments, whitespace) follows the root.
+        return true;
+      }
+      if (depth == 1) {
+        on_child(child_name, xml.substr(child_begin, end - child_begin));
+      }
+    } else {
+      const size_t close = detail::tagEnd(xml, position + 1);
+      if (close == NPOS) {
+        return false;
+      }
+      const size_t name_end       = xml.find_first_of(" \t\r\n/>", position + 1);
+      const std::string_view name = xml.substr(position + 1, name_end - position - 1);
+      if (name.empty()) {
+        return false;
+      }
+      const bool empty_element = xml[close - 1] == '/';
+      end                      = close + 1;
+      if (depth == 0 && empty_element) {
+        // Root without children.
+        return true;
+      }
+      if (depth == 1) {
+        child_begin = position;
+        child_name  = name;
+        if (empty_element) {
+          on_child(child_name, xml.substr(child_begin, end - child_begin));
+        }
+      }
+      if (!empty_element) {
+        ++depth;
+      }
+    }
+    if (end == NPOS) {
+      return false;
+    }
+    position = end;
+  }
+  // No root element or it was not closed.
+  return false;
+}
+
+}  // namespace util
@@ -0,0 +1,761 @@
+/**
+ * @file benchmark_settings.cpp
+ * @brief contains benchmarks using catch2 for the Settings class. They are hidden and only run if requested: `<test executable> "[benchmark]"`
+ *
+ * @date 16.10.2026
+ * @author Jakob Wandel
+ * @version 1.0
+ **/
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <tinyxml2.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <new>
+#include <optional>
+#include <span>
+#include <settings/binary.hpp>
+#include <settings/bulkParse.hpp>
+#include <settings/charconv.hpp>
+#include <settings/registry.hpp>
+#include <settings/sanitizerCall.hpp>
+#include <settings/settings.hpp>
+#include <string>
+#include <utility>
+#include <utils/templates/variadicFunction.hpp>
+#include <variant>
+#include <vector>
+
+// NOLINTBEGIN (readability-magic-numbers) Sizes of the benchmarks.
+
+namespace {
+
+// Counts the allocations of the calling thread while countAllocations() runs.
+// Everywhere else the operator new below only forwards to malloc.
+thread_local size_t* allocation_counter = nullptr;
+
+/*!
+ * @brief Calls function and counts the allocations it makes on this thread.
+ */
+template <class Function>
+size_t countAllocations(Function&& function) {
+  struct Restore {
+    size_t* outer;
+    ~Restore() { allocation_counter = outer; }
+  };
+  size_t count = 0;
+  const Restore restore{std::exchange(allocation_counter, &count)};
+  std::forward<Function>(function)();
+  return count;
+}
+
+}  // namespace
+
+void* operator new(std::size_t size) {
+  if (allocation_counter != nullptr) {
+    ++*allocation_counter;
+  }
+  if (void* memory = std::malloc(size == 0 ? 1 : size)) {
+    return memory;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept { std::free(memory); }
+
+void operator delete(void* memory, std::size_t /*size*/) noexcept { std::free(memory); }
+
+namespace {
+
+constexpr size_t NUM_REGISTERED = 5000;
+constexpr size_t NUM_NUMBERS    = 100000;
+
+std::vector<std::string> makeNames(size_t count) {
+  std::vector<std::string> names;
+  names.reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    names.push_back("registered_member_variable_" + std::to_string(i));
+  }
+  return names;
+}
+
+/*!
+ * @brief Builds an element holding count doubles as children "_0", "_1", ...
+ * like the Settings class stores a std::vector<double>.
+ */
+tinyxml2::XMLElement* makeDoubleVector(tinyxml2::XMLDocument& document, size_t count) {
+  tinyxml2::XMLElement* root = document.NewElement("vector");
+  document.InsertFirstChild(root);
+  for (size_t i = 0; i < count; ++i) {
+    tinyxml2::XMLElement* child = root->InsertNewChildElement(("_" + std::to_string(i)).c_str());
+    child->SetText(static_cast<double>(i) / 7.);
+  }
+  return root;
+}
+
+using BackendSettings =
+  util::Settings<std::variant<int*, double*, std::string*, std::vector<double>*, std::map<int, std::string>*>>;
+
+/*!
+ * @brief A mix of scalars and large containers to compare the xml and the
+ * binary backend.
+ */
+class BenchmarkBackendSettings : public BackendSettings {
+ public:
+  BenchmarkBackendSettings(const std::string& source_file_name)
+      : BackendSettings(source_file_name) {
+    const bool dont_throw_bad_parsing = true;
+    for (size_t i = 0; i < scalars.size(); ++i) {
+      put(&scalars[i], "scalar_" + std::to_string(i), dont_throw_bad_parsing);
+    }
+    put(&name, "name", dont_throw_bad_parsing);
+    put(&numbers, "numbers", dont_throw_bad_parsing);
+    put(&labels, "labels", dont_throw_bad_parsing);
+  }
+
+  std::array<int, 100> scalars{};
+  std::string name = "benchmark";
+  std::vector<double> numbers;
+  std::map<int, std::string> labels;
+};
+
+/*!
+ * @brief A large vector of doubles, saved with the given xml codec.
+ */
+template <class Codec>
+class BenchmarkVectorSettings : public util::Settings<std::variant<std::vector<double>*>, Codec> {
+ public:
+  BenchmarkVectorSettings(const std::string& source_file_name)
+      : util::Settings<std::variant<std::vector<double>*>, Codec>(source_file_name) {
+    this->put(&numbers, "numbers", true);
+  }
+
+  std::vector<double> numbers;
+};
+
+/*!
+ * @brief Peak resident memory of the process (VmHWM) in kB, 0 if unknown.
+ */
+size_t peakResidentKb() {
+  std::ifstream status("/proc/self/status");
+  std::string line;
+  while (std::getline(status, line)) {
+    if (line.rfind("VmHWM:", 0) == 0) {
+      return static_cast<size_t>(std::stoul(line.substr(6)));
+    }
+  }
+  return 0;
+}
+
+/*!
+ * @brief Resets the peak resident memory to the current one (Linux only).
+ */
+void resetPeakResident() {
+  std::ofstream clear_refs("/proc/self/clear_refs");
+  clear_refs << "5";
+}
+
+/*!
+ * @brief Large containers to compare saving through the document and
+ * streaming.
+ */
+class BenchmarkStreamingSettings : public BackendSettings {
+ public:
+  BenchmarkStreamingSettings(const std::string& source_file_name)
+      : BackendSettings(source_file_name) {
+    put(&numbers, "numbers", true);
+    put(&labels, "labels", true);
+    numbers.resize(NUM_NUMBERS);
+    for (size_t i = 0; i < numbers.size(); ++i) {
+      numbers[i] = static_cast<double>(i) / 7.;
+      labels.emplace(static_cast<int>(i % 10000), "label_" + std::to_string(i));
+    }
+  }
+
+  std::vector<double> numbers;
+  std::map<int, std::string> labels;
+};
+
+using ScalingSettings = util::Settings<std::variant<int*>>;
+
+/*!
+ * @brief The given number of int variables.
+ */
+class BenchmarkScalingSettings : public ScalingSettings {
+ public:
+  BenchmarkScalingSettings(const std::string& source_file_name, size_t num_values)
+      : ScalingSettings(source_file_name),
+        values(num_values) {
+    for (size_t i = 0; i < values.size(); ++i) {
+      values[i] = static_cast<int>(i);
+      put<int>(&values[i], "value_" + std::to_string(i), true);
+    }
+  }
+
+  std::vector<int> values;
+};
+
+/*!
+ * @brief Measures the fastest of a few reloads of a settings object with
+ * num_values registered members.
+ */
+double fastestReloadSeconds(const std::string& file, size_t num_values) {
+  std::remove(file.c_str());
+  BenchmarkScalingSettings settings(file, num_values);
+  settings.save();
+
+  double fastest = std::numeric_limits<double>::max();
+  for (int run = 0; run < 5; ++run) {
+    const auto start = std::chrono::steady_clock::now();
+    const std::vector<std::string> bad_variables = settings.reloadAllFromFile();
+    const auto end = std::chrono::steady_clock::now();
+    REQUIRE(bad_variables.empty());
+    fastest = std::min(fastest, std::chrono::duration<double>(end - start).count());
+  }
+  std::remove(file.c_str());
+  return fastest;
+}
+
+void clampValue(double& value, double min, double max) { value = std::clamp(value, min, max); }
+
+using SanitizedSettings = util::Settings<std::variant<double*>>;
+
+/*!
+ * @brief Many variables with a sanitizer each.
+ */
+class BenchmarkSanitizedSettings : public SanitizedSettings {
+ public:
+  BenchmarkSanitizedSettings(const std::string& source_file_name)
+      : SanitizedSettings(source_file_name) {
+    values.resize(NUM_REGISTERED);
+    for (size_t i = 0; i < values.size(); ++i) {
+      put<double>(&values[i], "value_" + std::to_string(i), true, &clampValue, 0., 1.);
+    }
+  }
+
+  std::vector<double> values;
+};
+
+
+// The variables registered by put() and by a Schema.
+struct SchemaValues {
+  double v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15;
+};
+
+constexpr std::array<double SchemaValues::*, 16> SCHEMA_MEMBERS = {
+  &SchemaValues::v0, &SchemaValues::v1, &SchemaValues::v2, &SchemaValues::v3,
+  &SchemaValues::v4, &SchemaValues::v5, &SchemaValues::v6, &SchemaValues::v7,
+  &SchemaValues::v8, &SchemaValues::v9, &SchemaValues::v10, &SchemaValues::v11,
+  &SchemaValues::v12, &SchemaValues::v13, &SchemaValues::v14, &SchemaValues::v15};
+
+// The name of the variable I, "field_00" to "field_15".
+template <size_t I>
+struct FieldName {
+  static constexpr char value[] = {'f', 'i', 'e', 'l', 'd', '_', '0' + I / 10, '0' + I % 10, 0};
+};
+
+using SchemaBenchmarkSettings = util::Settings<std::variant<double*>>;
+
+class BenchmarkPutSettings : public SchemaBenchmarkSettings, public SchemaValues {
+ public:
+  explicit BenchmarkPutSettings(std::span<const char> xml)
+      : SchemaBenchmarkSettings(xml) {
+    putAll(std::make_index_sequence<SCHEMA_MEMBERS.size()>{});
+  }
+
+ private:
+  template <size_t... I>
+  void putAll(std::index_sequence<I...> /*indices*/) {
+    (put<double>(&(this->*SCHEMA_MEMBERS[I]), FieldName<I>::value, true), ...);
+  }
+};
+
+template <class Indices>
+struct MakeSchema;
+
+template <size_t... I>
+struct MakeSchema<std::index_sequence<I...>> {
+  using type = util::Schema<util::Field<FieldName<I>::value, SCHEMA_MEMBERS[I], true>...>;
+};
+
+class BenchmarkSchemaSettings : public SchemaBenchmarkSettings, public SchemaValues {
+ public:
+  using Schema = MakeSchema<std::make_index_sequence<SCHEMA_MEMBERS.size()>>::type;
+
+  explicit BenchmarkSchemaSettings(std::span<const char> xml)
+      : SchemaBenchmarkSettings(xml) {
+    registerSchema<Schema>(this);
+  }
+};
+
+}  // namespace
+
+TEST_CASE("benchmark_registry_vs_map", "[.][benchmark]") {
+  const std::vector<std::string> names = makeNames(NUM_REGISTERED);
+
+  // Registration: put() inserts and looks the name up once.
+  BENCHMARK("registration std::map") {
+    std::map<std::string, size_t> map;
+    for (size_t i = 0; i < names.size(); ++i) {
+      map.emplace(names[i], i);
+      static_cast<void>(map.find(names[i]));
+    }
+    return map.size();
+  };
+
+  BENCHMARK("registration FlatRegistry") {
+    util::FlatRegistry<size_t> registry;
+    for (size_t i = 0; i < names.size(); ++i) {
+      registry.emplace(names[i], size_t{i});
+      static_cast<void>(registry.find(names[i]));
+    }
+    return registry.size();
+  };
+
+  // Reload: every element name of the file is looked up once.
+  std::map<std::string, size_t> map;
+  util::FlatRegistry<size_t> registry;
+  for (size_t i = 0; i < names.size(); ++i) {
+    map.emplace(names[i], i);
+    registry.emplace(names[i], size_t{i});
+  }
+
+  BENCHMARK("reload lookup std::map") {
+    size_t sum = 0;
+    for (const std::string& name : names) {
+      sum += map.find(name)->second;
+    }
+    return sum;
+  };
+
+  BENCHMARK("reload lookup FlatRegistry") {
+    size_t sum = 0;
+    for (const std::string& name : names) {
+      sum += registry.find(name)->second;
+    }
+    return sum;
+  };
+}
+
+TEST_CASE("benchmark_reload_scaling", "[.][benchmark]") {
+  const std::string file     = "benchmark_reload_scaling.xml";
+  constexpr size_t NUM_SMALL = 500;
+  constexpr size_t NUM_LARGE = 8 * NUM_SMALL;
+  // A linear reload takes 8 times as long for 8 times the variables, a
+  // quadratic one 64 times. Leave plenty of room for noise.
+  constexpr double MAX_RATIO = 24.;
+
+  const double small_seconds = fastestReloadSeconds(file, NUM_SMALL);
+  const double large_seconds = fastestReloadSeconds(file, NUM_LARGE);
+  WARN("reload " << NUM_SMALL << " variables: " << small_seconds * 1e3 << " ms, "
+                 << NUM_LARGE << " variables: " << large_seconds * 1e3 << " ms");
+  CHECK(large_seconds / small_seconds < MAX_RATIO);
+}
+
+TEST_CASE("benchmark_number_parsing", "[.][benchmark]") {
+  tinyxml2::XMLDocument document;
+  const tinyxml2::XMLElement* root = makeDoubleVector(document, NUM_NUMBERS);
+
+  BENCHMARK("QueryDoubleText") {
+    double sum = 0.;
+    for (const tinyxml2::XMLElement* child = root->FirstChildElement(); child != nullptr;
+         child = child->NextSiblingElement()) {
+      double value = 0.;
+      static_cast<void>(child->QueryDoubleText(&value));
+      sum += value;
+    }
+    return sum;
+  };
+
+  BENCHMARK("std::from_chars") {
+    double sum = 0.;
+    for (const tinyxml2::XMLElement* child = root->FirstChildElement(); child != nullptr;
+         child = child->NextSiblingElement()) {
+      double value = 0.;
+      static_cast<void>(util::parseNumber(child->GetText(), value));
+      sum += value;
+    }
+    return sum;
+  };
+}
+
+TEST_CASE("benchmark_number_formatting", "[.][benchmark]") {
+  std::vector<double> values(NUM_NUMBERS);
+  for (size_t i = 0; i < values.size(); ++i) {
+    values[i] = static_cast<double>(i) / 7.;
+  }
+
+  // Output size of the numbers only, the xml around them is the same.
+  size_t size_snprintf = 0;
+  size_t size_to_chars = 0;
+  tinyxml2::XMLDocument size_document;
+  tinyxml2::XMLElement* size_element = size_document.NewElement("size");
+  util::NumberBuffer buffer;
+  for (const double value : values) {
+    size_element->SetText(value);
+    size_snprintf += std::string(size_element->GetText()).size();
+    size_to_chars += std::string(util::formatNumber(value, buffer)).size();
+  }
+  WARN("text bytes for " << values.size() << " doubles: SetText(double) "
+                         << size_snprintf << ", std::to_chars " << size_to_chars);
+
+  BENCHMARK_ADVANCED("SetText(double)")(Catch::Benchmark::Chronometer meter) {
+    tinyxml2::XMLDocument document;
+    tinyxml2::XMLElement* root = document.NewElement("vector");
+    document.InsertFirstChild(root);
+    std::vector<tinyxml2::XMLElement*> children;
+    for (size_t i = 0; i < values.size(); ++i) {
+      children.push_back(root->InsertNewChildElement(("_" + std::to_string(i)).c_str()));
+    }
+    meter.measure([&] {
+      for (size_t i = 0; i < values.size(); ++i) {
+        children[i]->SetText(values[i]);
+      }
+    });
+  };
+
+  BENCHMARK_ADVANCED("std::to_chars")(Catch::Benchmark::Chronometer meter) {
+    tinyxml2::XMLDocument document;
+    tinyxml2::XMLElement* root = document.NewElement("vector");
+    document.InsertFirstChild(root);
+    std::vector<tinyxml2::XMLElement*> children;
+    for (size_t i = 0; i < values.size(); ++i) {
+      children.push_back(root->InsertNewChildElement(("_" + std::to_string(i)).c_str()));
+    }
+    meter.measure([&] {
+      util::NumberBuffer number_buffer;
+      for (size_t i = 0; i < values.size(); ++i) {
+        children[i]->SetText(util::formatNumber(values[i], number_buffer));
+      }
+    });
+  };
+}
+
+TEST_CASE("benchmark_xml_vs_binary", "[.][benchmark]") {
+  const std::string xml_file    = "benchmark_backend.xml";
+  const std::string binary_file = "benchmark_backend.bin";
+  std::remove(xml_file.c_str());
+
+  BenchmarkBackendSettings settings(xml_file);
+  for (size_t i = 0; i < settings.scalars.size(); ++i) {
+    settings.scalars[i] = static_cast<int>(i * i);
+  }
+  settings.numbers.resize(NUM_NUMBERS);
+  for (size_t i = 0; i < settings.numbers.size(); ++i) {
+    settings.numbers[i] = static_cast<double>(i) / 7.;
+  }
+  for (int i = 0; i < 1000; ++i) {
+    settings.labels[i] = "label_" + std::to_string(i);
+  }
+  settings.save();
+  settings.saveBinary(binary_file);
+  WARN("file size: xml " << std::filesystem::file_size(xml_file) << " bytes, binary "
+                         << std::filesystem::file_size(binary_file) << " bytes");
+
+  BENCHMARK("save xml") {
+    settings.markAllChanged();
+    return settings.save().size();
+  };
+  BENCHMARK("save binary") { settings.saveBinary(binary_file); };
+  BENCHMARK("load xml") { return settings.reloadAllFromFile().size(); };
+  BENCHMARK("load binary") { return settings.reloadAllFromBinaryFile(binary_file).size(); };
+
+  std::remove(xml_file.c_str());
+  std::remove(binary_file.c_str());
+}
+
+TEST_CASE("benchmark_save_after_small_change", "[.][benchmark]") {
+  const std::string xml_file = "benchmark_small_change.xml";
+  std::remove(xml_file.c_str());
+
+  BenchmarkBackendSettings settings(xml_file);
+  settings.numbers.resize(NUM_NUMBERS);
+  for (size_t i = 0; i < settings.numbers.size(); ++i) {
+    settings.numbers[i] = static_cast<double>(i) / 7.;
+  }
+  settings.save();
+
+  int change = 0;
+  BENCHMARK("save all") {
+    settings.scalars[0] = ++change;
+    settings.markAllChanged();
+    return settings.save().size();
+  };
+  BENCHMARK("save one changed scalar") {
+    settings.scalars[0] = ++change;
+    return settings.save().size();
+  };
+  BENCHMARK("save unchanged") { return settings.save().size(); };
+
+  std::remove(xml_file.c_str());
+}
+
+TEST_CASE("benchmark_save_durability", "[.][benchmark]") {
+  const std::string xml_file = "benchmark_durability.xml";
+  std::remove(xml_file.c_str());
+
+  BenchmarkBackendSettings settings(xml_file);
+  settings.numbers.resize(NUM_NUMBERS / 10);
+  for (size_t i = 0; i < settings.numbers.size(); ++i) {
+    settings.numbers[i] = static_cast<double>(i) / 7.;
+  }
+  settings.save();
+
+  const std::array<std::pair<util::SaveDurability, std::string>, 4> levels = {{
+    {util::SaveDurability::Direct, "direct"},
+    {util::SaveDurability::Atomic, "atomic"},
+    {util::SaveDurability::AtomicSyncFile, "atomic + fsync file"},
+    {util::SaveDurability::AtomicSyncAll, "atomic + fsync file and directory"}}};
+  for (const auto& [durability, name] : levels) {
+    settings.setSaveDurability(durability);
+    BENCHMARK("save " + name) {
+      settings.markAllChanged();
+      return settings.save().size();
+    };
+  }
+
+  std::remove(xml_file.c_str());
+}
+
+TEST_CASE("benchmark_packed_vs_elements", "[.][benchmark]") {
+  const std::string elements_file = "benchmark_elements.xml";
+  const std::string packed_file   = "benchmark_packed.xml";
+  std::remove(elements_file.c_str());
+  std::remove(packed_file.c_str());
+
+  BenchmarkVectorSettings<util::XmlCodec> elements(elements_file);
+  BenchmarkVectorSettings<util::PackedXmlCodec> packed(packed_file);
+  elements.numbers.resize(NUM_NUMBERS);
+  for (size_t i = 0; i < elements.numbers.size(); ++i) {
+    elements.numbers[i] = static_cast<double>(i) / 7.;
+  }
+  packed.numbers = elements.numbers;
+  elements.save();
+  packed.save();
+  WARN("file size for " << NUM_NUMBERS << " doubles: elements "
+                        << std::filesystem::file_size(elements_file) << " bytes, packed "
+                        << std::filesystem::file_size(packed_file) << " bytes");
+
+  BENCHMARK("save elements") {
+    elements.markAllChanged();
+    return elements.save().size();
+  };
+  BENCHMARK("save packed") {
+    packed.markAllChanged();
+    return packed.save().size();
+  };
+  BENCHMARK("load elements") { return elements.reloadAllFromFile().size(); };
+  BENCHMARK("load packed") { return packed.reloadAllFromFile().size(); };
+
+  std::remove(elements_file.c_str());
+  std::remove(packed_file.c_str());
+}
+
+TEST_CASE("benchmark_save_streaming", "[.][benchmark]") {
+  const std::string file = "benchmark_streaming.xml";
+  std::remove(file.c_str());
+
+  // Peak memory of the first save of fresh instances: save() creates a node
+  // per element, saveStreaming() only the text.
+  {
+    BenchmarkStreamingSettings dom(file);
+    resetPeakResident();
+    const size_t before = peakResidentKb();
+    dom.save();
+    WARN("save() peak memory +" << peakResidentKb() - before << " kB");
+  }
+  std::remove(file.c_str());
+  {
+    BenchmarkStreamingSettings streamed(file);
+    resetPeakResident();
+    const size_t before = peakResidentKb();
+    streamed.saveStreaming();
+    WARN("saveStreaming() peak memory +" << peakResidentKb() - before << " kB");
+  }
+
+  BenchmarkStreamingSettings settings(file);
+  BENCHMARK("save through the document") {
+    settings.markAllChanged();
+    return settings.save().size();
+  };
+  BENCHMARK("save streaming") { settings.saveStreaming(); };
+
+  std::remove(file.c_str());
+}
+
+TEST_CASE("benchmark_reload_streaming", "[.][benchmark]") {
+  const std::string file = "benchmark_reload_streaming.xml";
+  BenchmarkStreamingSettings settings(file);
+  settings.save();
+
+  // Peak memory: reloadAllFromFile() builds the document of the whole file,
+  // reloadAllStreaming() one entry at a time.
+  resetPeakResident();
+  size_t before = peakResidentKb();
+  settings.reloadAllFromFile();
+  WARN("reloadAllFromFile() peak memory +" << peakResidentKb() - before << " kB");
+  // Drop the document of the whole file.
+  settings.reloadAllStreaming();
+  resetPeakResident();
+  before = peakResidentKb();
+  settings.reloadAllStreaming();
+  WARN("reloadAllStreaming() peak memory +" << peakResidentKb() - before << " kB");
+
+  BENCHMARK("reload through the document") { return settings.reloadAllFromFile().size(); };
+  BENCHMARK("reload streaming") { return settings.reloadAllStreaming().size(); };
+
+  std::remove(file.c_str());
+}
+
+TEST_CASE("benchmark_sanitizer_calls", "[.][benchmark]") {
+  // The former storage of the sanitizers against the inline one.
+  std::vector<double> values(NUM_REGISTERED, 2.);
+  std::vector<std::unique_ptr<util::VirtualCall>> virtual_calls;
+  std::vector<util::SanitizerCall> inline_calls;
+  virtual_calls.reserve(values.size());
+  inline_calls.reserve(values.size());
+
+  size_t allocations = countAllocations([&] {
+    for (double& value : values) {
+      virtual_calls.push_back(
+        std::make_unique<util::VariadicFunction<double&, double, double>>(&clampValue, value, 0., 1.));
+    }
+  });
+  WARN("unique_ptr<VirtualCall>: " << allocations << " allocations for " << values.size()
+                                   << " sanitizers");
+  allocations = countAllocations([&] {
+    for (double& value : values) {
+      inline_calls.emplace_back(&clampValue, value, 0., 1.);
+    }
+  });
+  WARN("SanitizerCall: " << allocations << " allocations for " << values.size() << " sanitizers");
+
+  BENCHMARK("call virtual") {
+    for (const std::unique_ptr<util::VirtualCall>& call : virtual_calls) {
+      call->call();
+    }
+    return values.front();
+  };
+  BENCHMARK("call inline") {
+    for (util::SanitizerCall& call : inline_calls) {
+      call();
+    }
+    return values.front();
+  };
+
+  const std::string file = "benchmark_sanitized.xml";
+  std::remove(file.c_str());
+  std::optional<BenchmarkSanitizedSettings> settings;
+  allocations = countAllocations([&] { settings.emplace(file); });
+  WARN("registering " << NUM_REGISTERED << " sanitized variables: " << allocations
+                      << " allocations");
+  settings->save();
+  BENCHMARK("reload sanitized") { return settings->reloadAllFromFile().size(); };
+  std::remove(file.c_str());
+}
+
+TEST_CASE("benchmark_visit_vs_operations", "[.][benchmark]") {
+  // The former dispatch over the variant of the Settings class against the
+  // function pointer taken by put<T>(), encoding every variable once.
+  using Variant = std::variant<bool*, char*, wchar_t*, int*, unsigned int*, float*, double*,
+                               std::string*, std::wstring*>;
+  using Encode  = void (*)(util::BinaryWriter&, const void*);
+  std::vector<double> values(NUM_REGISTERED, 1.5);
+  std::vector<Variant> variants;
+  std::vector<std::pair<const void*, Encode>> operations;
+  for (double& value : values) {
+    variants.emplace_back(&value);
+    operations.emplace_back(&value, [](util::BinaryWriter& writer, const void* values_ptr) {
+      writer.write(*static_cast<const double*>(values_ptr));
+    });
+  }
+
+  util::BinaryWriter writer;
+  BENCHMARK("std::visit") {
+    writer.clear();
+    for (const Variant& variant : variants) {
+      std::visit([&writer](auto* value) { writer.write(*value); }, variant);
+    }
+    return writer.bytes().size();
+  };
+  BENCHMARK("operations") {
+    writer.clear();
+    for (const auto& [value, encode] : operations) {
+      encode(writer, value);
+    }
+    return writer.bytes().size();
+  };
+}
+
+TEST_CASE("benchmark_put_vs_schema", "[.][benchmark]") {
+  // Constructing from a document holding all variables: put() searches the
+  // document for each name (stored in reverse order), registerSchema() walks
+  // it once.
+  std::string xml = "<Settings>";
+  for (size_t i = SCHEMA_MEMBERS.size(); i-- > 0;) {
+    const std::string name = "field_" + std::to_string(i / 10) + std::to_string(i % 10);
+    xml += "<" + name + ">" + std::to_string(i) + "</" + name + ">";
+  }
+  xml += "</Settings>";
+  const std::span<const char> buffer(xml.data(), xml.size());
+  REQUIRE(BenchmarkSchemaSettings(buffer).*SCHEMA_MEMBERS[3] == 3.);
+
+  BENCHMARK("construct with put()") { return BenchmarkPutSettings(buffer).v0; };
+  BENCHMARK("construct with registerSchema()") { return BenchmarkSchemaSettings(buffer).v0; };
+}
+
+/*!
+ * @brief Parses the packed numbers with every supported instruction set and
+ * reports the best throughput.
+ */
+template <class T>
+void benchmarkBulkParse(const std::string& type_name) {
+  std::vector<T> expected(NUM_NUMBERS);
+  for (size_t i = 0; i < expected.size(); ++i) {
+    expected[i] = static_cast<T>(static_cast<double>(i) / 7.);
+  }
+  std::string text;
+  util::appendNumbers(std::span<const T>(expected), text);
+
+  std::vector<T> values(NUM_NUMBERS);
+  for (const util::SimdLevel level :
+       {util::SimdLevel::Scalar, util::SimdLevel::Sse42, util::SimdLevel::Avx2}) {
+    if (level > util::detectSimdLevel()) {
+      WARN(util::simdLevelName(level) << " is not supported by this cpu");
+      continue;
+    }
+    double best_seconds = 1e9;
+    for (int repetition = 0; repetition < 20; ++repetition) {
+      const auto start = std::chrono::steady_clock::now();
+      REQUIRE(util::parseNumbers(text, std::span(values), level));
+      const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+      best_seconds = std::min(best_seconds, duration.count());
+    }
+    REQUIRE(values == expected);
+    WARN(type_name << " " << util::simdLevelName(level) << ": "
+                   << static_cast<double>(NUM_NUMBERS) / best_seconds / 1e6 << " Mvalues/s");
+
+    BENCHMARK(type_name + " " + util::simdLevelName(level)) {
+      return util::parseNumbers(text, std::span(values), level);
+    };
+  }
+}
+
+TEST_CASE("benchmark_bulk_parse", "[.][benchmark]") {
+  benchmarkBulkParse<float>("float");
+  benchmarkBulkParse<double>("double");
+}
+
+// NOLINTEND (readability-magic-numbers)
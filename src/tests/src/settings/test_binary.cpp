@@ -0,0 +1,202 @@
+/**
+ * @file test_binary.cpp
+ * @brief contains the unit tests using catch2 for the binary format writer and reader.
+ *
+ * @date 16.10.2026
+ * @author Jakob Wandel
+ * @version 1.0
+ **/
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <list>
+#include <map>
+#include <set>
+#include <settings/binary.hpp>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+// NOLINTBEGIN (readability-magic-numbers) This test uses some random numbers, there is no value in giving them a name
+// NOLINTBEGIN (readability-function-cognitive-complexity) I blame the catch2 Macros
+
+TEST_CASE("binary_test_header_and_entries") {
+  util::BinaryWriter writer;
+  writer.writeHeader(2);
+  size_t length_position = writer.beginEntry("first", util::binaryTypeTag<int32_t>());
+  writer.write(int32_t{-7});
+  writer.endEntry(length_position);
+  length_position = writer.beginEntry("second", util::binaryTypeTag<std::string>());
+  writer.write(std::string("text"));
+  writer.endEntry(length_position);
+  const std::vector<char> bytes = writer.release();
+
+  // 12 header, 4 + 5 + 4 + 4 + 4 first, 4 + 6 + 4 + 4 + 4 + 4 second
+  CHECK(bytes.size() == 12 + 21 + 26);
+
+  util::BinaryReader reader(bytes);
+  uint32_t entry_count = 0;
+  REQUIRE(reader.readHeader(entry_count));
+  CHECK(entry_count == 2);
+
+  std::string_view name;
+  uint32_t type_tag = 0;
+  std::span<const char> payload;
+  REQUIRE(reader.readEntry(name, type_tag, payload));
+  CHECK(name == "first");
+  CHECK(type_tag == util::binaryTypeTag<int32_t>());
+  util::BinaryReader first(payload);
+  int32_t number = 0;
+  CHECK(first.read(number));
+  CHECK(number == -7);
+  CHECK(first.done());
+
+  REQUIRE(reader.readEntry(name, type_tag, payload));
+  CHECK(name == "second");
+  CHECK(type_tag == util::binaryTypeTag<std::string>());
+  util::BinaryReader second(payload);
+  std::string text;
+  CHECK(second.read(text));
+  CHECK(text == "text");
+  CHECK(second.done());
+  CHECK(reader.done());
+}
+
+TEST_CASE("binary_test_bad_header") {
+  uint32_t entry_count = 0;
+  std::vector<char> bytes = {'X', 'M', 'L', '!', 1, 0, 0, 0, 0, 0, 0, 0};
+  CHECK_FALSE(util::BinaryReader(bytes).readHeader(entry_count));
+
+  util::BinaryWriter writer;
+  writer.writeHeader(0);
+  bytes = writer.release();
+  // unknown version
+  bytes[4] = 3;
+  CHECK_FALSE(util::BinaryReader(bytes).readHeader(entry_count));
+  // truncated
+  bytes.resize(6);
+  CHECK_FALSE(util::BinaryReader(bytes).readHeader(entry_count));
+}
+
+TEST_CASE("binary_test_round_trip_types") {
+  const std::map<int, std::string> map = {{1, "one"}, {-2, ""}, {3, "three"}};
+  const std::set<double> set           = {0.1, -0.0, std::numeric_limits<double>::max()};
+  const std::vector<std::pair<char, std::wstring>> pairs = {{'a', L"Hello, 世界!"}, {'\0', L""}};
+
+  util::BinaryWriter writer;
+  writer.write(true);
+  writer.write(wchar_t{L'ß'});
+  writer.write(std::numeric_limits<uint64_t>::max());
+  writer.write(1.F / 3.F);
+  writer.write(map);
+  writer.write(set);
+  writer.write(pairs);
+  const std::vector<char> bytes = writer.release();
+
+  util::BinaryReader reader(bytes);
+  bool b = false;
+  wchar_t w{};
+  uint64_t u = 0;
+  float f    = 0.F;
+  std::map<int, std::string> map_read;
+  std::set<double> set_read;
+  std::vector<std::pair<char, std::wstring>> pairs_read;
+  CHECK(reader.read(b));
+  CHECK(reader.read(w));
+  CHECK(reader.read(u));
+  CHECK(reader.read(f));
+  CHECK(reader.read(map_read));
+  CHECK(reader.read(set_read));
+  CHECK(reader.read(pairs_read));
+  CHECK(reader.done());
+
+  CHECK(b);
+  CHECK(w == L'ß');
+  CHECK(u == std::numeric_limits<uint64_t>::max());
+  CHECK(f == 1.F / 3.F);
+  CHECK(map_read == map);
+  CHECK(set_read == set);
+  CHECK(pairs_read == pairs);
+}
+
+TEST_CASE("binary_test_unordered_containers") {
+  // Same content, different bucket counts and insertion order.
+  std::unordered_map<int, std::string> map;
+  std::unordered_map<int, std::string> other_map;
+  other_map.reserve(1024);
+  std::unordered_multimap<std::string, int> multimap;
+  std::unordered_multimap<std::string, int> other_multimap;
+  for (int i = 0; i < 100; ++i) {
+    map.emplace(i, std::to_string(i));
+    other_map.emplace(99 - i, std::to_string(99 - i));
+    multimap.emplace(std::to_string(i % 7), i);
+    other_multimap.emplace(std::to_string((99 - i) % 7), 99 - i);
+  }
+  const std::unordered_set<double> set       = {0.5, -1.0, 3.25, 1e10};
+  const std::unordered_set<double> other_set = {1e10, 3.25, -1.0, 0.5};
+
+  const auto encode = [](const auto& value) {
+    util::BinaryWriter writer;
+    writer.write(value);
+    return writer.release();
+  };
+  CHECK(encode(map) == encode(other_map));
+  CHECK(encode(multimap) == encode(other_multimap));
+  CHECK(encode(set) == encode(other_set));
+
+  const std::vector<char> bytes = encode(multimap);
+  std::unordered_multimap<std::string, int> multimap_read;
+  util::BinaryReader reader(bytes);
+  CHECK(reader.read(multimap_read));
+  CHECK(reader.done());
+  CHECK(multimap_read == multimap);
+}
+
+TEST_CASE("binary_test_corrupted_values") {
+  // bool must be 0 or 1
+  std::vector<char> bytes = {2};
+  bool b                  = false;
+  CHECK_FALSE(util::BinaryReader(bytes).read(b));
+
+  // the string is longer than the buffer
+  util::BinaryWriter writer;
+  writer.write(std::string("too long"));
+  bytes = writer.release();
+  bytes.pop_back();
+  std::string text;
+  util::BinaryReader reader(bytes);
+  CHECK_FALSE(reader.read(text));
+  CHECK_FALSE(reader.ok());
+  // all reads fail after the first failure
+  char c = 0;
+  CHECK_FALSE(reader.read(c));
+
+  // a huge count is rejected before allocating
+  bytes = {'\xff', '\xff', '\xff', '\x7f', 0, 0};
+  std::vector<double> vector;
+  CHECK_FALSE(util::BinaryReader(bytes).read(vector));
+  CHECK(vector.empty());
+}
+
+TEST_CASE("binary_test_type_tags") {
+  // Same size, different encoding.
+  CHECK(util::binaryTypeTag<float>() != util::binaryTypeTag<int32_t>());
+  CHECK(util::binaryTypeTag<int>() != util::binaryTypeTag<unsigned int>());
+  CHECK(util::binaryTypeTag<double>() != util::binaryTypeTag<int64_t>());
+  CHECK(util::binaryTypeTag<int32_t>() != util::binaryTypeTag<int64_t>());
+  CHECK(util::binaryTypeTag<std::map<int, std::string>>() !=
+        util::binaryTypeTag<std::map<std::string, int>>());
+  CHECK(util::binaryTypeTag<std::vector<int>>() != util::binaryTypeTag<std::set<int>>());
+  // Same encoding.
+  CHECK(util::binaryTypeTag<std::vector<int>>() == util::binaryTypeTag<std::list<int>>());
+  CHECK(util::binaryTypeTag<std::set<double>>() == util::binaryTypeTag<std::multiset<double>>());
+}
+
+// NOLINTEND (readability-magic-numbers)
+// NOLINTEND (readability-function-cognitive-complexity)
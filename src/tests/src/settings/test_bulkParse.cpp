@@ -0,0 +1,88 @@
+/**
+ * @file test_bulkParse.cpp
+ * @brief contains the unit tests using catch2 for the bulk parser of whitespace separated numbers.
+ *
+ * @date 16.10.2026
+ * @author Jakob Wandel
+ * @version 1.0
+ **/
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+#include <settings/bulkParse.hpp>
+#include <span>
+#include <string>
+#include <vector>
+
+// NOLINTBEGIN (readability-magic-numbers) This test uses some random numbers, there is no value in giving them a name
+// NOLINTBEGIN (readability-function-cognitive-complexity) I blame the catch2 Macros
+
+namespace {
+
+std::vector<util::SimdLevel> supportedLevels() {
+  std::vector<util::SimdLevel> levels = {util::SimdLevel::Scalar};
+  if (util::detectSimdLevel() >= util::SimdLevel::Sse42) {
+    levels.push_back(util::SimdLevel::Sse42);
+  }
+  if (util::detectSimdLevel() >= util::SimdLevel::Avx2) {
+    levels.push_back(util::SimdLevel::Avx2);
+  }
+  return levels;
+}
+
+}  // namespace
+
+TEST_CASE("bulk_parse_test_all_levels_agree") {
+  // Mixed separators and token lengths, so tokens and separator runs cross
+  // the 64 byte blocks at every offset.
+  std::string text = "\n\t ";
+  std::vector<double> expected;
+  const std::string separators[] = {" ", "\t", "\r\n", "   ", "\n\n\t "};
+  for (int i = 0; i < 1000; ++i) {
+    const double value = static_cast<double>(i * i) / 7. - 300.;
+    util::NumberBuffer buffer;
+    text += util::formatNumber(value, buffer);
+    text += separators[i % 5];
+    expected.push_back(value);
+  }
+
+  for (const util::SimdLevel level : supportedLevels()) {
+    INFO(util::simdLevelName(level));
+    std::vector<double> values(expected.size());
+    CHECK(util::parseNumbers(text, std::span(values), level));
+    CHECK(values == expected);
+
+    // Exactly values.size() numbers are required.
+    std::vector<double> too_many(expected.size() + 1);
+    CHECK_FALSE(util::parseNumbers(text, std::span(too_many), level));
+    std::vector<double> too_few(expected.size() - 1);
+    CHECK_FALSE(util::parseNumbers(text, std::span(too_few), level));
+  }
+}
+
+TEST_CASE("bulk_parse_test_tokens") {
+  for (const util::SimdLevel level : supportedLevels()) {
+    INFO(util::simdLevelName(level));
+    std::vector<int32_t> ints(4);
+    CHECK(util::parseNumbers("1 -2 +3 0x10", std::span(ints), level));
+    CHECK(ints == std::vector<int32_t>{1, -2, 3, 16});
+    CHECK_FALSE(util::parseNumbers("1 -2 3x 4", std::span(ints), level));
+    CHECK_FALSE(util::parseNumbers("1 -2 3 99999999999", std::span(ints), level));
+    CHECK_FALSE(util::parseNumbers("1,2,3,4", std::span(ints), level));
+
+    std::vector<float> empty;
+    CHECK(util::parseNumbers("", std::span(empty), level));
+    CHECK(util::parseNumbers(" \n ", std::span(empty), level));
+    CHECK_FALSE(util::parseNumbers(" 1 ", std::span(empty), level));
+
+    // A long token crossing a block boundary.
+    const std::string long_token = std::string(60, ' ') + "0.0000000000000000000000001";
+    std::vector<double> one(1);
+    CHECK(util::parseNumbers(long_token, std::span(one), level));
+    CHECK(one[0] == 1e-25);
+  }
+}
+
+// NOLINTEND (readability-magic-numbers)
+// NOLINTEND (readability-function-cognitive-complexity)
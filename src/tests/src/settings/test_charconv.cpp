@@ -0,0 +1,85 @@
+/**
+ * @file test_charconv.cpp
+ * @brief contains the unit tests using catch2 for the locale independent number parsing.
+ *
+ * @date 16.10.2026
+ * @author Jakob Wandel
+ * @version 1.0
+ **/
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <settings/charconv.hpp>
+
+// NOLINTBEGIN (readability-magic-numbers) This test uses some random numbers, there is no value in giving them a name
+// NOLINTBEGIN (readability-function-cognitive-complexity) I blame the catch2 Macros
+
+TEST_CASE("charconv_test_parse_integers") {
+  int i = 0;
+  CHECK(util::parseNumber("42", i));
+  CHECK(i == 42);
+  CHECK(util::parseNumber("  -17\n ", i));
+  CHECK(i == -17);
+  CHECK(util::parseNumber("+8", i));
+  CHECK(i == 8);
+  CHECK(util::parseNumber("0x1F", i));
+  CHECK(i == 31);
+
+  i = 5;
+  CHECK_FALSE(util::parseNumber("", i));
+  CHECK_FALSE(util::parseNumber("   ", i));
+  CHECK_FALSE(util::parseNumber("12abc", i));
+  CHECK_FALSE(util::parseNumber("1 2", i));
+  CHECK_FALSE(util::parseNumber("+-1", i));
+  CHECK_FALSE(util::parseNumber("0x-1", i));
+  CHECK_FALSE(util::parseNumber("99999999999", i));
+  CHECK(i == 5);
+
+  unsigned int u = 0;
+  CHECK(util::parseNumber("4294967295", u));
+  CHECK(u == std::numeric_limits<unsigned int>::max());
+  CHECK_FALSE(util::parseNumber("-1", u));
+
+  int64_t i64 = 0;
+  CHECK(util::parseNumber("-9223372036854775808", i64));
+  CHECK(i64 == std::numeric_limits<int64_t>::min());
+
+  uint64_t u64 = 0;
+  CHECK(util::parseNumber("18446744073709551615", u64));
+  CHECK(u64 == std::numeric_limits<uint64_t>::max());
+}
+
+TEST_CASE("charconv_test_parse_floating_point") {
+  double d = 0.;
+  CHECK(util::parseNumber("3.141592653589793", d));
+  CHECK(d == 3.141592653589793);
+  CHECK(util::parseNumber(" 1e-300 ", d));
+  CHECK(d == 1e-300);
+  CHECK(util::parseNumber("-2.5E3", d));
+  CHECK(d == -2500.);
+  CHECK(util::parseNumber("+0.5", d));
+  CHECK(d == 0.5);
+  CHECK(util::parseNumber("inf", d));
+  CHECK(std::isinf(d));
+  CHECK(util::parseNumber("-inf", d));
+  CHECK((std::isinf(d) && d < 0.));
+  CHECK(util::parseNumber("nan", d));
+  CHECK(std::isnan(d));
+
+  d = 1.;
+  CHECK_FALSE(util::parseNumber("1,5", d));
+  CHECK_FALSE(util::parseNumber("1.5.5", d));
+  CHECK_FALSE(util::parseNumber("true", d));
+  CHECK(d == 1.);
+
+  float f = 0.F;
+  CHECK(util::parseNumber("0.333333343", f));
+  CHECK(f == 1.F / 3.F);
+  CHECK_FALSE(util::parseNumber("1e99", f));
+}
+
+// NOLINTEND (readability-magic-numbers)
+// NOLINTEND (readability-function-cognitive-complexity)
@@ -0,0 +1,86 @@
+/**
+ * @file test_fileIo.cpp
+ * @brief contains the unit tests using catch2 for the file helpers of the Settings class.
+ *
+ * @date 16.10.2026
+ * @author Jakob Wandel
+ * @version 1.0
+ **/
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <settings/fileIo.hpp>
+#include <string>
+
+namespace {
+
+const std::string FILE_NAME = "FileIoTest.txt";
+
+bool writeText(const std::filesystem::path& path, const std::string& text) {
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  file << text;
+  return static_cast<bool>(file);
+}
+
+std::string readText(const std::filesystem::path& path) {
+  std::ifstream file(path, std::ios::binary);
+  return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+}
+
+size_t countTemporaryFiles() {
+  size_t count = 0;
+  for (const auto& entry : std::filesystem::directory_iterator(".")) {
+    if (entry.path().filename().string().starts_with(FILE_NAME + ".tmp.")) {
+      ++count;
+    }
+  }
+  return count;
+}
+
+}  // namespace
+
+TEST_CASE("file_io_test_write_file_all_durabilities") {
+  for (const util::SaveDurability durability :
+       {util::SaveDurability::Direct, util::SaveDurability::Atomic,
+        util::SaveDurability::AtomicSyncFile, util::SaveDurability::AtomicSyncAll}) {
+    std::remove(FILE_NAME.c_str());
+    CHECK(util::writeFile(FILE_NAME, durability, [](const std::filesystem::path& path) {
+      return writeText(path, "first");
+    }));
+    CHECK(readText(FILE_NAME) == "first");
+    CHECK(util::writeFile(FILE_NAME, durability, [](const std::filesystem::path& path) {
+      return writeText(path, "second");
+    }));
+    CHECK(readText(FILE_NAME) == "second");
+    CHECK(countTemporaryFiles() == 0);
+  }
+  std::remove(FILE_NAME.c_str());
+}
+
+TEST_CASE("file_io_test_atomic_write_failure_keeps_file") {
+  std::remove(FILE_NAME.c_str());
+  REQUIRE(writeText(FILE_NAME, "old content"));
+  std::filesystem::permissions(FILE_NAME, std::filesystem::perms::owner_read |
+                                            std::filesystem::perms::owner_write);
+
+  // The writer crashes halfway through.
+  CHECK_FALSE(util::writeFile(FILE_NAME, util::SaveDurability::AtomicSyncAll, [](const std::filesystem::path& path) {
+    writeText(path, "new con");
+    return false;
+  }));
+  CHECK(readText(FILE_NAME) == "old content");
+  CHECK(countTemporaryFiles() == 0);
+
+  // The replacement keeps the permissions of the file.
+  CHECK(util::writeFile(FILE_NAME, util::SaveDurability::Atomic, [](const std::filesystem::path& path) {
+    return writeText(path, "new content");
+  }));
+  CHECK(readText(FILE_NAME) == "new content");
+  CHECK(std::filesystem::status(FILE_NAME).permissions() ==
+        (std::filesystem::perms::owner_read | std::filesystem::perms::owner_write));
+  std::remove(FILE_NAME.c_str());
+}
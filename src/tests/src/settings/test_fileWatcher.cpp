@@ -0,0 +1,116 @@
+/**
+ * @file test_fileWatcher.cpp
+ * @brief contains the unit tests using catch2 for the watcher of the source file.
+ *
+ * @date 16.10.2026
+ * @author Jakob Wandel
+ * @version 1.0
+ **/
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <settings/fileWatcher.hpp>
+#include <string>
+#include <thread>
+
+// NOLINTBEGIN (readability-magic-numbers) The times and counts have no meaning.
+// NOLINTBEGIN (readability-function-cognitive-complexity) I blame the catch2 Macros
+
+using namespace std::chrono_literals;
+
+namespace {
+
+const std::string FILE_NAME  = "FileWatcherTest.txt";
+const std::string OTHER_NAME = "FileWatcherOther.txt";
+
+void writeText(const std::filesystem::path& path, const std::string& text) {
+  std::ofstream file(path, std::ios::trunc);
+  file << text;
+}
+
+// Waits until the counter reaches the value or a generous timeout passed.
+bool waitFor(const std::atomic<int>& counter, int value) {
+  for (int i = 0; i < 400 && counter < value; ++i) {
+    std::this_thread::sleep_for(5ms);
+  }
+  return counter >= value;
+}
+
+}  // namespace
+
+#if SETTINGS_HAS_INOTIFY
+
+TEST_CASE("file_watcher_sees_write_and_replace") {
+  writeText(FILE_NAME, "a");
+  std::atomic<int> changes{0};
+  // Much longer than the burst of writes takes, even on a loaded machine.
+  constexpr std::chrono::milliseconds DEBOUNCE = 300ms;
+  util::FileWatcher watcher(FILE_NAME, DEBOUNCE, [&changes] { ++changes; });
+  REQUIRE(watcher.status() == util::FileWatcher::Status::Ok);
+
+  // A burst of writes is reported once.
+  for (int i = 0; i < 5; ++i) {
+    writeText(FILE_NAME, std::to_string(i));
+  }
+  CHECK(waitFor(changes, 1));
+  std::this_thread::sleep_for(2 * DEBOUNCE);
+  CHECK(changes == 1);
+  CHECK(watcher.takeChange());
+  CHECK_FALSE(watcher.takeChange());
+
+  // Replaced by rename like editors do.
+  writeText(OTHER_NAME, "b");
+  std::filesystem::rename(OTHER_NAME, FILE_NAME);
+  CHECK(waitFor(changes, 2));
+
+  // Other files in the directory are ignored.
+  writeText(OTHER_NAME, "c");
+  std::this_thread::sleep_for(2 * DEBOUNCE);
+  CHECK(changes == 2);
+  std::remove(OTHER_NAME.c_str());
+  std::remove(FILE_NAME.c_str());
+}
+
+TEST_CASE("file_watcher_ignores_own_writes") {
+  writeText(FILE_NAME, "a");
+  std::atomic<int> changes{0};
+  util::FileWatcher watcher(FILE_NAME, 20ms, [&changes] { ++changes; });
+  REQUIRE(watcher.status() == util::FileWatcher::Status::Ok);
+
+  {
+    const util::FileWatcher::OwnWrite own_write(&watcher);
+    writeText(FILE_NAME, "own");
+  }
+  std::this_thread::sleep_for(100ms);
+  CHECK(changes == 0);
+  CHECK_FALSE(watcher.takeChange());
+
+  // The debounce time passes before the write is recorded.
+  {
+    const util::FileWatcher::OwnWrite own_write(&watcher);
+    writeText(FILE_NAME, "slow own write");
+    std::this_thread::sleep_for(100ms);
+  }
+  std::this_thread::sleep_for(100ms);
+  CHECK(changes == 0);
+  CHECK_FALSE(watcher.takeChange());
+
+  writeText(FILE_NAME, "someone else");
+  CHECK(waitFor(changes, 1));
+  std::remove(FILE_NAME.c_str());
+}
+
+TEST_CASE("file_watcher_missing_directory") {
+  const util::FileWatcher watcher("not_existing_directory/" + FILE_NAME, 20ms, [] {});
+  CHECK(watcher.status() == util::FileWatcher::Status::CouldNotWatch);
+}
+
+#endif
+
+// NOLINTEND (readability-magic-numbers)
+// NOLINTEND (readability-function-cognitive-complexity)
@@ -0,0 +1,125 @@
+/**
+ * @file test_jsonCodec.cpp
+ * @brief contains the unit tests using catch2 for the json parser and printer used by the JsonCodec.
+ *
+ * @date 16.10.2026
+ * @author Jakob Wandel
+ * @version 1.0
+ **/
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cmath>
+#include <limits>
+#include <settings/jsonCodec.hpp>
+#include <string>
+#include <string_view>
+
+// NOLINTBEGIN (readability-function-cognitive-complexity) I blame the catch2 Macros
+
+namespace {
+
+bool parse(std::string_view json, util::JsonValue& value) {
+  return util::JsonParser(json).parse(value);
+}
+
+}  // namespace
+
+TEST_CASE("json_test_parse_document") {
+  util::JsonValue value;
+  REQUIRE(parse(R"( {"a": [1, -2.5e3, true, null], "b": {"c": "x\"y\\nä😀"}, "d": []} )", value));
+  REQUIRE(value.type == util::JsonValue::Type::Object);
+  REQUIRE(value.object.size() == 3);
+  CHECK(value.object[0].name == "a");
+  const util::JsonValue& a = value.object[0].value;
+  REQUIRE(a.array.size() == 4);
+  CHECK(a.array[0].type == util::JsonValue::Type::Number);
+  CHECK(a.array[0].text == "1");
+  CHECK(a.array[1].text == "-2.5e3");
+  CHECK(a.array[2].boolean);
+  CHECK(a.array[3].type == util::JsonValue::Type::Null);
+  const util::JsonValue& c = value.object[1].value.object[0].value;
+  CHECK(c.text == "x\"y\\n\xC3\xA4\xF0\x9F\x98\x80");
+  CHECK(value.object[2].value.array.empty());
+}
+
+TEST_CASE("json_test_parse_errors") {
+  util::JsonValue value;
+  CHECK_FALSE(parse("", value));
+  CHECK_FALSE(parse("{", value));
+  CHECK_FALSE(parse(R"({"a": 1,})", value));
+  CHECK_FALSE(parse(R"({"a" 1})", value));
+  CHECK_FALSE(parse(R"({"a": tru})", value));
+  CHECK_FALSE(parse(R"({"a": "unterminated})", value));
+  CHECK_FALSE(parse(R"({"a": "\ud83d"})", value));
+  CHECK_FALSE(parse(R"({"a": 1} x)", value));
+  CHECK_FALSE(parse(std::string(1000, '['), value));
+}
+
+TEST_CASE("json_test_number_grammar") {
+  for (const std::string_view number : {"0", "-0", "12", "-0.5", "1e9", "2.5E-3", "1e+2"}) {
+    const std::string json = std::string(R"({"a": )") + std::string(number) + "}";
+    util::JsonValue value;
+    REQUIRE(parse(json, value));
+    CHECK(value.object[0].value.text == number);
+  }
+  for (const std::string_view number : {"-", "e", "1.2.3", "+1", "01", "1.", ".5", "1e", "1e+", "--1", "0x10"}) {
+    const std::string json = std::string(R"({"a": )") + std::string(number) + "}";
+    util::JsonValue value;
+    CHECK_FALSE(parse(json, value));
+  }
+}
+
+TEST_CASE("json_test_non_finite_strings") {
+  util::JsonCodec codec;
+  const std::string json = R"({"inf": "-inf", "nan": "nan", "text": "1.5", "int": "inf"})";
+  REQUIRE(codec.loadBuffer(json) == util::DocumentStatus::Ok);
+  double number = 0.;
+  CHECK(codec.read(codec.find("inf"), &number, 1) == util::CodecStatus::Ok);
+  CHECK(number == -std::numeric_limits<double>::infinity());
+  CHECK(codec.read(codec.find("nan"), &number, 1) == util::CodecStatus::Ok);
+  CHECK(std::isnan(number));
+  // Only the non finite numbers are stored as strings.
+  number = 0.;
+  CHECK(codec.read(codec.find("text"), &number, 1) == util::CodecStatus::Invalid);
+  int integer = 0;
+  CHECK(codec.read(codec.find("int"), &integer, 1) == util::CodecStatus::Invalid);
+}
+
+TEST_CASE("json_test_print_and_parse_again") {
+  util::JsonValue value;
+  const std::string json = R"({"name": "tab\there", "list": [1, 2, 3], "pairs": [[1, "one"], [2, "two"]], "empty": {}})";
+  REQUIRE(parse(json, value));
+
+  std::string printed;
+  util::JsonPrinter::print(value, printed);
+  CHECK(printed ==
+        "{\n"
+        "  \"name\": \"tab\\there\",\n"
+        "  \"list\": [1, 2, 3],\n"
+        "  \"pairs\": [\n"
+        "    [1, \"one\"],\n"
+        "    [2, \"two\"]\n"
+        "  ],\n"
+        "  \"empty\": {}\n"
+        "}");
+
+  util::JsonValue reparsed;
+  REQUIRE(parse(printed, reparsed));
+  std::string printed_again;
+  util::JsonPrinter::print(reparsed, printed_again);
+  CHECK(printed_again == printed);
+}
+
+TEST_CASE("json_test_entry_hash") {
+  util::JsonCodec codec;
+  const std::string json = R"({"a": [1, 2], "b": [1, 2], "c": [1, 3], "d": "[1, 2]"})";
+  REQUIRE(codec.loadBuffer(json) == util::DocumentStatus::Ok);
+  const size_t a = util::JsonCodec::entryHash(codec.find("a"));
+  // Independent of the name, but not of the value or its type.
+  CHECK(a == util::JsonCodec::entryHash(codec.find("b")));
+  CHECK(a != util::JsonCodec::entryHash(codec.find("c")));
+  CHECK(a != util::JsonCodec::entryHash(codec.find("d")));
+}
+
+// NOLINTEND (readability-function-cognitive-complexity)
@@ -0,0 +1,99 @@
+/**
+ * @file test_published.cpp
+ * @brief contains the unit tests using catch2 for publishing settings to reader threads.
+ *
+ * @date 16.10.2026
+ * @author Jakob Wandel
+ * @version 1.0
+ **/
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+#include <memory>
+#include <settings/published.hpp>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+// NOLINTBEGIN (readability-magic-numbers) The counts have no meaning.
+// NOLINTBEGIN (readability-function-cognitive-complexity) I blame the catch2 Macros
+
+namespace {
+
+// Stands in for a class derived from Settings: the factory fills all members
+// like the constructor would load them from the file.
+struct Values {
+  int generation = 0;
+  std::string text;
+  std::vector<int> numbers;
+};
+
+std::unique_ptr<Values> makeValues(int generation) {
+  auto values        = std::make_unique<Values>();
+  values->generation = generation;
+  values->text       = std::to_string(generation);
+  values->numbers.assign(100, generation);
+  return values;
+}
+
+}  // namespace
+
+TEST_CASE("published_reload_and_reader") {
+  int generation = 0;
+  util::Published<Values> published([&generation] { return makeValues(++generation); });
+  util::Published<Values>::Reader reader = published.reader();
+  CHECK(reader.get().generation == 1);
+
+  const std::shared_ptr<const Values> kept = published.current();
+  published.reload();
+  CHECK(reader.get().generation == 2);
+  // Instances taken before stay valid.
+  CHECK(kept->generation == 1);
+
+  // A failing reload keeps the published instance.
+  util::Published<Values> failing([&generation]() -> std::unique_ptr<Values> {
+    if (generation > 2) {
+      throw std::runtime_error("could not load");
+    }
+    return makeValues(++generation);
+  });
+  CHECK_THROWS_AS(failing.reload(), std::runtime_error);
+  CHECK(failing.current()->generation == 3);
+  CHECK_THROWS_AS(failing.publish(nullptr), std::runtime_error);
+}
+
+TEST_CASE("published_consistent_under_concurrent_reload") {
+  int generation = 0;
+  util::Published<Values> published([&generation] { return makeValues(++generation); });
+
+  std::atomic<bool> stop{false};
+  std::atomic<int> torn{0};
+  std::vector<std::thread> readers;
+  for (int r = 0; r < 4; ++r) {
+    readers.emplace_back([&published, &stop, &torn] {
+      util::Published<Values>::Reader reader = published.reader();
+      while (!stop) {
+        const Values& values = reader.get();
+        const std::string expected = std::to_string(values.generation);
+        if (values.text != expected || values.numbers.front() != values.generation ||
+            values.numbers.back() != values.generation) {
+          ++torn;
+        }
+      }
+    });
+  }
+  for (int i = 0; i < 2000; ++i) {
+    published.reload();
+  }
+  stop = true;
+  for (std::thread& reader : readers) {
+    reader.join();
+  }
+  CHECK(torn == 0);
+  CHECK(published.current()->generation == 2001);
+}
+
+// NOLINTEND (readability-magic-numbers)
+// NOLINTEND (readability-function-cognitive-complexity)
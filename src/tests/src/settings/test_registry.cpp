@@ -0,0 +1,74 @@
+/**
+ * @file test_registry.cpp
+ * @brief contains the unit tests using catch2 for the FlatRegistry class.
+ *
+ * @date 16.10.2026
+ * @author Jakob Wandel
+ * @version 1.0
+ **/
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstddef>
+#include <settings/registry.hpp>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// NOLINTBEGIN (readability-magic-numbers) This test uses some random numbers, there is no value in giving them a name
+// NOLINTBEGIN (readability-function-cognitive-complexity) I blame the catch2 Macros
+
+TEST_CASE("registry_test_emplace_and_find") {
+  util::FlatRegistry<int> registry;
+  CHECK(registry.empty());
+  CHECK(registry.find("missing") == registry.end());
+
+  const auto [it, inserted] = registry.emplace("first", 1);
+  CHECK(inserted);
+  CHECK(it->first == "first");
+  CHECK(it->second == 1);
+
+  const auto [it_duplicate, inserted_duplicate] = registry.emplace("first", 2);
+  CHECK_FALSE(inserted_duplicate);
+  CHECK(it_duplicate->second == 1);
+  CHECK(registry.size() == 1);
+
+  const std::string name = "second";
+  registry.emplace(name, 2);
+  CHECK(registry.find(std::string_view(name))->second == 2);
+  CHECK(registry.find("first")->second == 1);
+  CHECK(registry.find("third") == registry.end());
+}
+
+TEST_CASE("registry_test_many_entries_keep_registration_order") {
+  constexpr int NUM_ENTRIES = 5000;
+  util::FlatRegistry<int> registry;
+  for (int i = 0; i < NUM_ENTRIES; ++i) {
+    REQUIRE(registry.emplace("entry_" + std::to_string(i), int{i}).second);
+  }
+  REQUIRE(registry.size() == NUM_ENTRIES);
+
+  for (int i = 0; i < NUM_ENTRIES; ++i) {
+    const auto it = registry.find("entry_" + std::to_string(i));
+    REQUIRE(it != registry.end());
+    CHECK(it->second == i);
+  }
+  CHECK(registry.find("entry_" + std::to_string(NUM_ENTRIES)) == registry.end());
+
+  int expected = 0;
+  for (const auto& [name, value] : registry) {
+    CHECK(value == expected++);
+  }
+}
+
+TEST_CASE("registry_test_reserve") {
+  util::FlatRegistry<std::vector<int>> registry;
+  registry.reserve(100);
+  for (int i = 0; i < 100; ++i) {
+    registry.emplace(std::to_string(i), std::vector<int>(3, i));
+  }
+  CHECK(registry.find("42")->second == std::vector<int>(3, 42));
+}
+
+// NOLINTEND (readability-magic-numbers)
+// NOLINTEND (readability-function-cognitive-complexity)
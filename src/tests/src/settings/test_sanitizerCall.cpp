@@ -0,0 +1,92 @@
+/**
+ * @file test_sanitizerCall.cpp
+ * @brief contains the unit tests using catch2 for the inline stored sanitizer call.
+ *
+ * @date 16.10.2026
+ * @author Jakob Wandel
+ * @version 1.0
+ **/
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <memory>
+#include <settings/sanitizerCall.hpp>
+#include <utility>
+#include <vector>
+
+// NOLINTBEGIN (readability-magic-numbers) The values have no meaning.
+// NOLINTBEGIN (readability-function-cognitive-complexity) I blame the catch2 Macros
+
+namespace {
+
+void clamp(int& value, int min, int max) {
+  value = value < min ? min : (value > max ? max : value);
+}
+
+void addAll(int& value, std::array<int, 32> summands) {
+  for (const int summand : summands) {
+    value += summand;
+  }
+}
+
+void keep(int& value, std::shared_ptr<int> counted) { value = *counted; }
+
+}  // namespace
+
+TEST_CASE("sanitizer_call_inline_and_heap") {
+  int value = 50;
+  util::SanitizerCall small(&clamp, value, 0, 10);
+  CHECK(small);
+  CHECK(small.isInline());
+  small();
+  CHECK(value == 10);
+
+  std::array<int, 32> summands{};
+  summands.fill(1);
+  util::SanitizerCall large(&addAll, value, summands);
+  CHECK(large);
+  CHECK_FALSE(large.isInline());
+  large();
+  CHECK(value == 42);
+
+  util::SanitizerCall none;
+  CHECK_FALSE(none);
+  CHECK_FALSE(none.isInline());
+  none();
+  CHECK(value == 42);
+}
+
+TEST_CASE("sanitizer_call_move_and_destroy") {
+  int value    = 0;
+  auto counted = std::make_shared<int>(7);
+  {
+    std::vector<util::SanitizerCall> calls;
+    calls.emplace_back(&keep, value, counted);
+    CHECK(counted.use_count() == 2);
+    // Growing the vector moves the calls.
+    for (int i = 0; i < 10; ++i) {
+      calls.emplace_back(&clamp, value, 0, i);
+    }
+    CHECK(counted.use_count() == 2);
+    calls.front()();
+    CHECK(value == 7);
+
+    util::SanitizerCall moved = std::move(calls.front());
+    CHECK_FALSE(calls.front());
+    CHECK(counted.use_count() == 2);
+    *counted = 8;
+    moved();
+    CHECK(value == 8);
+
+    moved = std::move(calls.back());
+    // The replaced call released its arguments.
+    CHECK(counted.use_count() == 1);
+    moved();
+    CHECK(value == 8);
+  }
+  CHECK(counted.use_count() == 1);
+}
+
+// NOLINTEND (readability-magic-numbers)
+// NOLINTEND (readability-function-cognitive-complexity)
@@ -0,0 +1,88 @@
+/**
+ * @file test_saveScheduler.cpp
+ * @brief contains the unit tests using catch2 for the coalescing save scheduler.
+ *
+ * @date 16.10.2026
+ * @author Jakob Wandel
+ * @version 1.0
+ **/
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <settings/saveScheduler.hpp>
+#include <thread>
+
+// NOLINTBEGIN (readability-magic-numbers) The times and counts have no meaning.
+// NOLINTBEGIN (readability-function-cognitive-complexity) I blame the catch2 Macros
+
+using namespace std::chrono_literals;
+
+TEST_CASE("save_scheduler_coalesces_until_flush") {
+  std::atomic<int> written_value{0};
+  std::atomic<int> writes{0};
+  util::SaveScheduler scheduler(10s, 60s);
+  for (int i = 1; i <= 50; ++i) {
+    scheduler.request([&written_value, &writes, i] {
+      written_value = i;
+      ++writes;
+    });
+  }
+  CHECK(writes == 0);
+  scheduler.flush();
+  CHECK(writes == 1);
+  CHECK(written_value == 50);
+  const util::SaveCounters counters = scheduler.saveCounters();
+  CHECK(counters.requested == 50);
+  CHECK(counters.performed == 1);
+
+  // Nothing pending, nothing to do.
+  scheduler.flush();
+  CHECK(writes == 1);
+}
+
+TEST_CASE("save_scheduler_writes_after_window") {
+  std::atomic<int> writes{0};
+  util::SaveScheduler scheduler(1ms, 60s);
+  scheduler.request([&writes] { ++writes; });
+  for (int i = 0; i < 1000 && writes == 0; ++i) {
+    std::this_thread::sleep_for(5ms);
+  }
+  CHECK(writes == 1);
+  CHECK(scheduler.saveCounters().performed == 1);
+}
+
+TEST_CASE("save_scheduler_writes_after_max_latency") {
+  std::atomic<int> writes{0};
+  util::SaveScheduler scheduler(60s, 20ms);
+  // The requests keep coming in faster than the window, the max latency
+  // forces a write anyway.
+  for (int i = 0; i < 1000 && writes == 0; ++i) {
+    scheduler.request([&writes] { ++writes; });
+    std::this_thread::sleep_for(5ms);
+  }
+  CHECK(writes >= 1);
+}
+
+TEST_CASE("save_scheduler_writes_pending_on_destruction") {
+  std::atomic<int> writes{0};
+  {
+    util::SaveScheduler scheduler(60s, 60s);
+    scheduler.request([&writes] { ++writes; });
+    scheduler.request([&writes] { ++writes; });
+  }
+  CHECK(writes == 1);
+}
+
+TEST_CASE("save_scheduler_flush_rethrows") {
+  util::SaveScheduler scheduler(60s, 60s);
+  scheduler.request([] { throw std::runtime_error("could not write"); });
+  CHECK_THROWS_AS(scheduler.flush(), std::runtime_error);
+  // The error is reported once.
+  CHECK_NOTHROW(scheduler.flush());
+}
+
+// NOLINTEND (readability-magic-numbers)
+// NOLINTEND (readability-function-cognitive-complexity)
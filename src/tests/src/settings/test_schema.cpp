@@ -0,0 +1,101 @@
+/**
+ * @file test_schema.cpp
+ * @brief contains the unit tests using catch2 for the compile time schema of a Settings class.
+ *
+ * @date 16.10.2026
+ * @author Jakob Wandel
+ * @version 1.0
+ **/
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <settings/schema.hpp>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+// NOLINTBEGIN (readability-function-cognitive-complexity) I blame the catch2 Macros
+
+namespace {
+
+struct Members {
+  int a = 0;
+  int b = 0;
+  double c[2]{};
+  std::array<int, 3> d{};
+  std::string e;
+};
+
+using MembersSchema = util::Schema<util::Field<"a", &Members::a, true>,
+                                   util::Field<"b", &Members::b, false>,
+                                   util::Field<"c", &Members::c, true>,
+                                   util::Field<"longer_name_d", &Members::d, true>,
+                                   util::Field<"_e", &Members::e, true>,
+                                   util::Field<"f", &Members::a, true>,
+                                   util::Field<"g", &Members::a, true>,
+                                   util::Field<"h", &Members::a, true>,
+                                   util::Field<"i", &Members::a, true>,
+                                   util::Field<"j", &Members::a, true>,
+                                   util::Field<"k", &Members::a, true>,
+                                   util::Field<"l", &Members::a, true>,
+                                   util::Field<"m", &Members::a, true>,
+                                   util::Field<"n", &Members::a, true>,
+                                   util::Field<"o", &Members::a, true>,
+                                   util::Field<"p", &Members::a, true>,
+                                   util::Field<"q", &Members::a, true>>;
+
+}  // namespace
+
+TEST_CASE("schema_index_of") {
+  // Resolved by the compiler as well.
+  static_assert(MembersSchema::indexOf("longer_name_d") == 3);
+  static_assert(MembersSchema::indexOf("unknown") == MembersSchema::size);
+
+  for (size_t i = 0; i < MembersSchema::size; ++i) {
+    CHECK(MembersSchema::indexOf(MembersSchema::names[i]) == i);
+  }
+  for (const std::string name : {"", "x", "A", "a ", "longer_name", "longer_name_dd", "_0"}) {
+    CHECK(MembersSchema::indexOf(name) == MembersSchema::size);
+  }
+  CHECK(util::Schema<>::indexOf("a") == 0);
+
+  size_t visited = 0;
+  MembersSchema::forEachField([&visited]<class FieldT>() {
+    CHECK(FieldT::name == MembersSchema::names[visited]);
+    CHECK(FieldT::ignore_read_error == (visited != 1));
+    ++visited;
+  });
+  CHECK(visited == MembersSchema::size);
+}
+
+TEST_CASE("schema_rejected_names") {
+  // The checks behind the static_asserts of Schema.
+  constexpr std::array<std::string_view, 3> unique    = {"a", "b", "c"};
+  constexpr std::array<std::string_view, 3> duplicate = {"a", "b", "a"};
+  constexpr std::array<std::string_view, 2> space     = {"a", "b c"};
+  constexpr std::array<std::string_view, 2> empty     = {"a", ""};
+  STATIC_REQUIRE(util::detail::hasUniqueNames(unique));
+  STATIC_REQUIRE_FALSE(util::detail::hasUniqueNames(duplicate));
+  STATIC_REQUIRE(util::detail::hasValidNames(unique));
+  STATIC_REQUIRE_FALSE(util::detail::hasValidNames(space));
+  STATIC_REQUIRE_FALSE(util::detail::hasValidNames(empty));
+}
+
+TEST_CASE("schema_field_storage") {
+  // Arrays are registered like put<T, N>().
+  Members members{};
+  using Scalar   = util::detail::FieldStorage<int>;
+  using CArray   = util::detail::FieldStorage<double[2]>;
+  using StdArray = util::detail::FieldStorage<std::array<int, 3>>;
+  STATIC_REQUIRE(std::is_same_v<CArray::Element, double>);
+  STATIC_REQUIRE(std::is_same_v<StdArray::Element, int>);
+  STATIC_REQUIRE(Scalar::size == 1);
+  STATIC_REQUIRE(CArray::size == 2);
+  STATIC_REQUIRE(StdArray::size == 3);
+  CHECK(Scalar::first(members.a) == &members.a);
+  CHECK(CArray::first(members.c) == &members.c[0]);
+  CHECK(StdArray::first(members.d) == members.d.data());
+}
+
+// NOLINTEND (readability-function-cognitive-complexity)
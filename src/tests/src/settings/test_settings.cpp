@@ -13,14 +13,33 @@
 #include <cstdio>
 #include <tinyxml2.h>
 
+#include <algorithm>
 #include <array>
+#include <chrono>
 #include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <iterator>
 #include <limits>
 #include <map>
+#include <numeric>
+#include <optional>
 #include <set>
+#include <span>
+#include <settings/jsonCodec.hpp>
+#include <settings/published.hpp>
 #include <settings/sanitizers.hpp>
 #include <settings/settings.hpp>
 #include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
 
 static const std::string SAVE_FILE      = "ExampleSettingsMemberVariables.xml";
 static const std::string SAVE_FILE_MOVE = "ExampleSettingsMemberVariables2.xml";
@@ -58,6 +77,7 @@ static const std::string EXAMPLE_ARRAY_D = "test_array_d";
 
 static const std::string EXAMPLE_VECTOR_I = "test_vector_i";
 static const std::string EXAMPLE_SET_D    = "test_set_d";
+static const std::string EXAMPLE_UNORDERED_MAP = "test_unordered_map";
 
 namespace test {
 
@@ -778,6 +798,1308 @@ TEST_CASE("settings_test_stl_support_save") {
   REQUIRE(es2.arraysed_pairs == es.arraysed_pairs);
 }
 
+namespace test {
+
+using ScalingSettings = util::Settings<std::variant<int*>>;
+class ExampleScalingSettings : public ScalingSettings {
+ public:
+  ExampleScalingSettings(const std::string& source_file_name, size_t num_values)
+      : ScalingSettings(source_file_name),
+        values(num_values) {
+    const bool dont_throw_bad_parsing = true;
+    for (size_t i = 0; i < values.size(); ++i) {
+      values[i] = static_cast<int>(i);
+      put<int>(&values[i], "value_" + std::to_string(i), dont_throw_bad_parsing);
+    }
+  }
+
+  std::vector<int> values;
+};
+
+}  // namespace test
+
+TEST_CASE("settings_test_reload_reports_missing_variables") {
+  std::remove(SAVE_FILE.c_str());
+  test::ExampleScalingSettings es(SAVE_FILE, 20);
+  es.save();
+
+  tinyxml2::XMLDocument settingsDocument;
+  REQUIRE(settingsDocument.LoadFile(SAVE_FILE.c_str()) == tinyxml2::XMLError::XML_SUCCESS);
+  tinyxml2::XMLNode* settings = settingsDocument.FirstChild();
+  REQUIRE(settings != nullptr);
+
+  // remove one, corrupt one and change one value
+  settings->DeleteChild(settings->FirstChildElement("value_3"));
+  settings->FirstChildElement("value_7")->SetText("not a number");
+  settings->FirstChildElement("value_11")->SetText(1111);
+  REQUIRE(settingsDocument.SaveFile(SAVE_FILE.c_str()) == tinyxml2::XMLError::XML_SUCCESS);
+
+  std::vector<std::string> bad_variables = es.reloadAllFromFile();
+  std::sort(bad_variables.begin(), bad_variables.end());
+  CHECK(bad_variables == std::vector<std::string>{"value_3", "value_7"});
+  CHECK(es.values[3] == 3);
+  CHECK(es.values[7] == 7);
+  CHECK(es.values[11] == 1111);
+
+  // saving adds the missing variable again and overwrites the corrupted one
+  es.save();
+  CHECK(es.reloadAllFromFile().empty());
+  CHECK(es.values[3] == 3);
+  CHECK(es.values[7] == 7);
+  CHECK(es.values[11] == 1111);
+}
+
+namespace test {
+
+using LargeContainerSettings =
+  util::Settings<std::variant<std::vector<unsigned>*, std::map<int, double>*>>;
+class ExampleLargeContainerSettings : public LargeContainerSettings {
+ public:
+  ExampleLargeContainerSettings(const std::string& source_file_name)
+      : LargeContainerSettings(source_file_name) {
+    const bool dont_throw_bad_parsing = true;
+    put(&vector, EXAMPLE_VECTOR_I, dont_throw_bad_parsing);
+    put(&map, EXAMPLE_ARRAYED_MAP, dont_throw_bad_parsing);
+  }
+
+  std::vector<unsigned> vector;
+  std::map<int, double> map;
+};
+
+}  // namespace test
+
+TEST_CASE("settings_test_large_container_load") {
+  constexpr unsigned NUM_ELEMENTS = 200000;
+  std::remove(SAVE_FILE.c_str());
+
+  test::ExampleLargeContainerSettings es(SAVE_FILE);
+  es.vector.resize(NUM_ELEMENTS);
+  for (unsigned i = 0; i < NUM_ELEMENTS; ++i) {
+    es.vector[i] = i * 3;
+  }
+  for (int i = 0; i < 1000; ++i) {
+    es.map[i] = i * 0.5;
+  }
+  es.save();
+
+  test::ExampleLargeContainerSettings es2(SAVE_FILE);
+  REQUIRE(es2.vector == es.vector);
+  REQUIRE(es2.map == es.map);
+  std::remove(SAVE_FILE.c_str());
+}
+
+TEST_CASE("settings_test_container_wrong_child_index") {
+  std::remove(SAVE_FILE.c_str());
+
+  test::ExampleLargeContainerSettings es(SAVE_FILE);
+  es.vector = {1, 2, 3};
+  es.map    = {{1, 1.}, {2, 2.}};
+  es.save();
+
+  tinyxml2::XMLDocument settingsDocument;
+  REQUIRE(settingsDocument.LoadFile(SAVE_FILE.c_str()) == tinyxml2::XMLError::XML_SUCCESS);
+  tinyxml2::XMLNode* settings = settingsDocument.FirstChild();
+  REQUIRE(settings != nullptr);
+  tinyxml2::XMLElement* vector_element = settings->FirstChildElement(EXAMPLE_VECTOR_I.c_str());
+  REQUIRE(vector_element != nullptr);
+  vector_element->FirstChildElement("_1")->SetName("_5");
+  tinyxml2::XMLElement* map_element = settings->FirstChildElement(EXAMPLE_ARRAYED_MAP.c_str());
+  REQUIRE(map_element != nullptr);
+  map_element->FirstChildElement("_1")->FirstChildElement("_0")->SetName("_01");
+  REQUIRE(settingsDocument.SaveFile(SAVE_FILE.c_str()) == tinyxml2::XMLError::XML_SUCCESS);
+
+  std::vector<std::string> bad_variables = es.reloadAllFromFile();
+  std::sort(bad_variables.begin(), bad_variables.end());
+  CHECK(bad_variables == std::vector<std::string>{EXAMPLE_ARRAYED_MAP, EXAMPLE_VECTOR_I});
+  std::remove(SAVE_FILE.c_str());
+}
+
+namespace test {
+
+class ExampleMappedSettings : public LargeContainerSettings {
+ public:
+  ExampleMappedSettings(const std::string& source_file_name)
+      : LargeContainerSettings(source_file_name, util::FileLoadMode::MemoryMapped) {
+    const bool dont_throw_bad_parsing = true;
+    put(&vector, EXAMPLE_VECTOR_I, dont_throw_bad_parsing);
+    put(&map, EXAMPLE_ARRAYED_MAP, dont_throw_bad_parsing);
+  }
+
+  std::vector<unsigned> vector;
+  std::map<int, double> map;
+};
+
+}  // namespace test
+
+TEST_CASE("settings_test_memory_mapped_load") {
+  std::remove(SAVE_FILE.c_str());
+
+  // file does not exist yet
+  test::ExampleMappedSettings es(SAVE_FILE);
+  CHECK(es.vector.empty());
+  es.vector = {4, 5, 6, 7};
+  es.map    = {{-1, 0.25}, {3, 1e-9}};
+  es.save();
+
+  test::ExampleMappedSettings es2(SAVE_FILE);
+  CHECK(es2.vector == es.vector);
+  CHECK(es2.map == es.map);
+
+  // reload a buffered instance through the mapping
+  test::ExampleLargeContainerSettings es3(SAVE_FILE);
+  es3.vector.clear();
+  es3.setFileLoadMode(util::FileLoadMode::MemoryMapped);
+  CHECK(es3.reloadAllFromFile().empty());
+  CHECK(es3.vector == es.vector);
+
+  // empty file
+  std::fclose(std::fopen(SAVE_FILE.c_str(), "w"));
+  test::ExampleMappedSettings es4(SAVE_FILE);
+  CHECK(es4.vector.empty());
+  std::remove(SAVE_FILE.c_str());
+}
+
+TEST_CASE("settings_test_memory_mapped_load_not_regular_file") {
+  // Character devices can not be mapped, the buffered path is used instead.
+  if (std::filesystem::exists("/dev/null")) {
+    test::ExampleMappedSettings es("/dev/null");
+    CHECK(es.vector.empty());
+  }
+}
+
+namespace test {
+
+class ExampleCachedSettings : public LargeContainerSettings {
+ public:
+  ExampleCachedSettings(std::span<const char> xml)
+      : LargeContainerSettings(xml) {
+    const bool dont_throw_bad_parsing = true;
+    put(&vector, EXAMPLE_VECTOR_I, dont_throw_bad_parsing);
+    put(&map, EXAMPLE_ARRAYED_MAP, dont_throw_bad_parsing);
+  }
+
+  std::vector<unsigned> vector;
+  std::map<int, double> map;
+};
+
+}  // namespace test
+
+TEST_CASE("settings_test_load_from_buffer") {
+  // The buffer is not null terminated and is overwritten after each use.
+  const std::string xml =
+    "<Settings><test_vector_i><_0>1</_0><_1>2</_1></test_vector_i>"
+    "<map_inside_array><_0>5<_0>0.5</_0></_0></map_inside_array></Settings>";
+  std::vector<char> buffer(xml.begin(), xml.end());
+
+  test::ExampleCachedSettings es{std::span<const char>(buffer)};
+  std::fill(buffer.begin(), buffer.end(), 'x');
+  CHECK(es.vector == std::vector<unsigned>{1, 2});
+  CHECK(es.map == std::map<int, double>{{5, 0.5}});
+
+  const std::string xml2 =
+    "<Settings><test_vector_i><_0>3</_0></test_vector_i></Settings>";
+  buffer.assign(xml2.begin(), xml2.end());
+  std::vector<std::string> bad_variables = es.reloadAllFromCache(buffer);
+  std::fill(buffer.begin(), buffer.end(), 'x');
+  CHECK(bad_variables == std::vector<std::string>{EXAMPLE_ARRAYED_MAP});
+  CHECK(es.vector == std::vector<unsigned>{3});
+
+  bad_variables = es.reloadAllFromCache(std::string_view(xml));
+  CHECK(bad_variables.empty());
+  CHECK(es.vector == std::vector<unsigned>{1, 2});
+}
+
+namespace test {
+
+using FloatingSettings =
+  util::Settings<std::variant<double*, float*, std::vector<double>*, std::vector<float>*>>;
+class ExampleFloatingSettings : public FloatingSettings {
+ public:
+  ExampleFloatingSettings(const std::string& source_file_name)
+      : FloatingSettings(source_file_name) {
+    const bool dont_throw_bad_parsing = true;
+    put(&exampleDouble, EXAMPLE_DOUBLE, dont_throw_bad_parsing);
+    put(&exampleFloat, EXAMPLE_FLOAT, dont_throw_bad_parsing);
+    put(&doubles, EXAMPLE_ARRAY_D, dont_throw_bad_parsing);
+    put(&floats, EXAMPLE_ARRAY_F, dont_throw_bad_parsing);
+  }
+
+  double exampleDouble = 0.;
+  float exampleFloat   = 0.F;
+  std::vector<double> doubles;
+  std::vector<float> floats;
+};
+
+}  // namespace test
+
+TEST_CASE("settings_test_floating_point_round_trip_is_exact") {
+  std::remove(SAVE_FILE.c_str());
+
+  test::ExampleFloatingSettings es(SAVE_FILE);
+  es.exampleDouble = 0.1 + 0.2;
+  es.exampleFloat  = 1.F / 3.F;
+  es.doubles       = {std::numeric_limits<double>::min(),
+                      std::numeric_limits<double>::max(),
+                      std::numeric_limits<double>::denorm_min(),
+                      std::numeric_limits<double>::epsilon(),
+                      -std::numeric_limits<double>::infinity(),
+                      -0.,
+                      2. / 3.,
+                      1e23,
+                      123456789.123456789};
+  es.floats        = {std::numeric_limits<float>::min(),
+                      std::numeric_limits<float>::max(),
+                      std::numeric_limits<float>::denorm_min(),
+                      0.1F,
+                      16777217.F};
+  for (int i = 1; i < 1000; ++i) {
+    es.doubles.push_back(1. / static_cast<double>(i * 7919));
+    es.floats.push_back(1.F / static_cast<float>(i * 31));
+  }
+  es.save();
+
+  test::ExampleFloatingSettings es2(SAVE_FILE);
+  CHECK(es2.exampleDouble == es.exampleDouble);
+  CHECK(es2.exampleFloat == es.exampleFloat);
+  REQUIRE(es2.doubles.size() == es.doubles.size());
+  REQUIRE(es2.floats.size() == es.floats.size());
+  for (size_t i = 0; i < es.doubles.size(); ++i) {
+    CHECK(std::signbit(es2.doubles[i]) == std::signbit(es.doubles[i]));
+    CHECK(es2.doubles[i] == es.doubles[i]);
+  }
+  for (size_t i = 0; i < es.floats.size(); ++i) {
+    CHECK(es2.floats[i] == es.floats[i]);
+  }
+
+  // the shortest representation is written
+  tinyxml2::XMLDocument settingsDocument;
+  REQUIRE(settingsDocument.LoadFile(SAVE_FILE.c_str()) == tinyxml2::XMLError::XML_SUCCESS);
+  const tinyxml2::XMLElement* floats =
+    settingsDocument.FirstChild()->FirstChildElement(EXAMPLE_ARRAY_F.c_str());
+  REQUIRE(floats != nullptr);
+  CHECK(std::string(floats->FirstChildElement("_3")->GetText()) == "0.1");
+  std::remove(SAVE_FILE.c_str());
+}
+
+TEST_CASE("settings_test_binary_round_trip") {
+  std::remove(SAVE_FILE.c_str());
+  const std::string binary_file = "ExampleSettingsMemberVariables.bin";
+
+  test::ExampleSettings es(SAVE_FILE);
+  es.exampleBool   = DEF_BOOL[1];
+  es.exampleInt    = DEF_INT[2];
+  es.exampleUint   = DEF_UINT[2];
+  es.exampleFloat  = DEF_FLOAT[2];
+  es.exampleDouble = DEF_DOUBLE[2];
+  es.exampleStr    = DEF_STR[2];
+  es.exampleWStr   = DEF_WSTR[0];
+
+  test::ExampleSettingsStlContainer stl(SAVE_FILE_MOVE);
+  stl.vector = {-10, 0, 10};
+  stl.set    = {0.1, 0.2};
+  stl.arraysed_map[1].insert({2, "zwei"});
+  stl.arraysed_map[2].insert({3, "tres"});
+  stl.arraysed_pairs[0] = {99, "neinUndNeunzig"};
+  stl.arraysed_pairs[2] = {13, "drölf"};
+
+  es.saveBinary(binary_file);
+  const std::vector<char> stl_bytes = stl.saveBinary();
+
+  // The xml files are not touched by the binary format.
+  CHECK_FALSE(std::filesystem::exists(SAVE_FILE));
+
+  test::ExampleSettings es2(SAVE_FILE);
+  CHECK(es2.reloadAllFromBinaryFile(binary_file).empty());
+  CHECK(es2.exampleBool == es.exampleBool);
+  CHECK(es2.exampleInt == es.exampleInt);
+  CHECK(es2.exampleUint == es.exampleUint);
+  CHECK(es2.exampleFloat == es.exampleFloat);
+  CHECK(es2.exampleDouble == es.exampleDouble);
+  CHECK(es2.exampleStr == es.exampleStr);
+  CHECK(es2.exampleWStr == es.exampleWStr);
+
+  test::ExampleSettingsStlContainer stl2(SAVE_FILE_MOVE);
+  CHECK(stl2.reloadAllFromBinary(stl_bytes).empty());
+  CHECK(stl2.vector == stl.vector);
+  CHECK(stl2.set == stl.set);
+  CHECK(stl2.arraysed_map == stl.arraysed_map);
+  CHECK(stl2.arraysed_pairs == stl.arraysed_pairs);
+
+  // The file of another class: the names do not match.
+  const std::vector<std::string> bad = stl2.reloadAllFromBinaryFile(binary_file);
+  CHECK(bad.size() == 4);
+
+  std::remove(binary_file.c_str());
+  std::remove(SAVE_FILE_MOVE.c_str());
+}
+
+TEST_CASE("settings_test_binary_bad_entries") {
+  std::remove(SAVE_FILE.c_str());
+
+  test::ExampleSettingsArray es(SAVE_FILE);
+  es.i_array = {{1, 2, 3, 4, 5}};
+  std::vector<char> bytes = es.saveBinary();
+
+  test::ExampleSettingsArray es2(SAVE_FILE);
+  CHECK(es2.reloadAllFromBinary(bytes).empty());
+  CHECK(es2.i_array == es.i_array);
+
+  // Not a binary file at all.
+  const std::string xml = "<Settings></Settings>";
+  CHECK(es2.reloadAllFromBinary(std::span<const char>(xml.data(), xml.size())).size() == 5);
+
+  // Cut off inside the last entry: it is reported, the others are loaded.
+  bytes.pop_back();
+  es2.d_array = {};
+  const std::vector<std::string> bad = es2.reloadAllFromBinary(bytes);
+  REQUIRE(bad.size() == 1);
+  CHECK(bad[0] == EXAMPLE_ARRAY_D);
+  CHECK(es2.i_array == es.i_array);
+  // The bad entry did not touch the variable.
+  CHECK(es2.d_array == std::array<double, NUM_VALS>{});
+
+  // Stored with another type of the same size: reported, not reinterpreted.
+  util::BinaryWriter writer;
+  writer.writeHeader(2);
+  size_t length_position = writer.beginEntry(EXAMPLE_ARRAY_I, util::binaryTypeTag<float>());
+  for (size_t i = 0; i < NUM_VALS; ++i) {
+    writer.write(1.5F);
+  }
+  writer.endEntry(length_position);
+  length_position = writer.beginEntry(EXAMPLE_ARRAY_UI, util::binaryTypeTag<int>());
+  for (size_t i = 0; i < NUM_VALS; ++i) {
+    writer.write(-1);
+  }
+  writer.endEntry(length_position);
+  es2.ui_array = es.ui_array;
+  const std::vector<std::string> mismatched = es2.reloadAllFromBinary(writer.bytes());
+  CHECK(std::find(mismatched.begin(), mismatched.end(), EXAMPLE_ARRAY_I) != mismatched.end());
+  CHECK(std::find(mismatched.begin(), mismatched.end(), EXAMPLE_ARRAY_UI) != mismatched.end());
+  CHECK(es2.i_array == es.i_array);
+  CHECK(es2.ui_array == es.ui_array);
+
+  // A file which does not exist.
+  CHECK(es2.reloadAllFromBinaryFile("does_not_exist.bin").size() == 5);
+  std::remove(SAVE_FILE.c_str());
+}
+
+namespace test {
+
+using JsonSettings = util::Settings<
+  std::variant<bool*, char*, wchar_t*, int*, unsigned int*, float*, double*, std::string*, std::wstring*, std::vector<int>*, std::set<double>*, std::map<int, std::string>*, std::pair<int, std::string>*>,
+  util::JsonCodec>;
+class ExampleJsonSettings : public JsonSettings {
+ public:
+  ExampleJsonSettings(const std::string& source_file_name)
+      : JsonSettings(source_file_name) {
+    const bool dont_throw_bad_parsing = true;
+    put(&exampleBool, EXAMPLE_BOOL, dont_throw_bad_parsing);
+    put(&exampleChar, "ExampleChar", dont_throw_bad_parsing);
+    put(&exampleWChar, "ExampleWChar", dont_throw_bad_parsing);
+    put(&exampleInt, EXAMPLE_INT, dont_throw_bad_parsing);
+    put(&exampleUint, EXAMPLE_UINT, dont_throw_bad_parsing);
+    put(&exampleFloat, EXAMPLE_FLOAT, dont_throw_bad_parsing);
+    put(&exampleDouble, EXAMPLE_DOUBLE, dont_throw_bad_parsing);
+    put(&exampleStr, EXAMPLE_STRING, dont_throw_bad_parsing);
+    put(&exampleWStr, EXAMPLE_WSTRING, dont_throw_bad_parsing);
+    put<double, NUM_VALS>(d_array.data(), EXAMPLE_ARRAY_D, dont_throw_bad_parsing);
+    put(&vector, EXAMPLE_VECTOR_I, dont_throw_bad_parsing, saneVectorValues, ExampleSettingsStlContainer::RANGE);
+    put(&set, EXAMPLE_SET_D, dont_throw_bad_parsing);
+    put<std::map<int, std::string>, 3>(arraysed_map.data(), EXAMPLE_ARRAYED_MAP, dont_throw_bad_parsing);
+    put(&pair, EXAMPLE_ARRAYED_PAIR, dont_throw_bad_parsing);
+  }
+
+  bool exampleBool                     = DEF_BOOL[0];
+  char exampleChar                     = 'a';
+  wchar_t exampleWChar                 = L'a';
+  int exampleInt                       = DEF_INT[0];
+  unsigned int exampleUint             = DEF_UINT[0];
+  float exampleFloat                   = DEF_FLOAT[0];
+  double exampleDouble                 = DEF_DOUBLE[0];
+  std::string exampleStr               = DEF_STR[0];
+  std::wstring exampleWStr             = DEF_WSTR[0];
+  std::array<double, NUM_VALS> d_array = TEST_ARRAY_D;
+  std::vector<int> vector;
+  std::set<double> set;
+  std::array<std::map<int, std::string>, 3> arraysed_map;
+  std::pair<int, std::string> pair;
+};
+
+}  // namespace test
+
+TEST_CASE("settings_test_json_codec_save_and_reload") {
+  const std::string json_file = "ExampleSettingsMemberVariables.json";
+  std::remove(json_file.c_str());
+
+  test::ExampleJsonSettings es(json_file);
+  es.exampleBool     = DEF_BOOL[1];
+  es.exampleChar     = '"';
+  es.exampleWChar    = L'ß';
+  es.exampleInt      = DEF_INT[2];
+  es.exampleUint     = DEF_UINT[2];
+  es.exampleFloat    = std::numeric_limits<float>::infinity();
+  es.exampleDouble   = DEF_DOUBLE[2];
+  es.exampleStr      = "quote \" backslash \\ newline \n";
+  es.exampleWStr     = DEF_WSTR[1];
+  es.d_array         = {{0.1, -0.2, 1e300, 0., 5.}};
+  es.vector          = {-20, 0, 20};
+  es.set             = {0.25, 0.5};
+  es.arraysed_map[0] = {{1, "one"}, {2, "two"}};
+  es.arraysed_map[2] = {{-3, "drei"}};
+  es.pair            = {13, "drölf"};
+  es.save();  // the sanitizer clamps the vector to [-10, 100]
+
+  test::ExampleJsonSettings es2(json_file);
+  CHECK(es2.exampleBool == es.exampleBool);
+  CHECK(es2.exampleChar == es.exampleChar);
+  CHECK(es2.exampleWChar == es.exampleWChar);
+  CHECK(es2.exampleInt == es.exampleInt);
+  CHECK(es2.exampleUint == es.exampleUint);
+  CHECK(es2.exampleFloat == es.exampleFloat);
+  CHECK(es2.exampleDouble == es.exampleDouble);
+  CHECK(es2.exampleStr == es.exampleStr);
+  CHECK(es2.exampleWStr == es.exampleWStr);
+  CHECK(es2.d_array == es.d_array);
+  CHECK(es2.vector == std::vector<int>{-10, 0, 20});
+  CHECK(es2.set == es.set);
+  CHECK(es2.arraysed_map == es.arraysed_map);
+  CHECK(es2.pair == es.pair);
+
+  // A member written by someone else is kept, a broken one is reported.
+  std::string json;
+  {
+    std::ifstream file(json_file);
+    json.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+  }
+  json.replace(json.find('{'), 1, "{\n  \"unknown\": [1, 2],");
+  const std::string int_key = "\"" + EXAMPLE_INT + "\": ";
+  const size_t int_position  = json.find(int_key) + int_key.size();
+  REQUIRE(int_position > int_key.size());
+  json.replace(int_position, json.find(',', int_position) - int_position, "\"abc\"");
+  const std::vector<std::string> bad = es2.reloadAllFromCache(std::span<const char>(json.data(), json.size()));
+  REQUIRE(bad.size() == 1);
+  CHECK(bad[0] == EXAMPLE_INT);
+  es2.save();
+  {
+    std::ifstream file(json_file);
+    json.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+  }
+  CHECK(json.find("\"unknown\": [1, 2]") != std::string::npos);
+
+  std::remove(json_file.c_str());
+}
+
+TEST_CASE("settings_test_json_codec_invalid_document") {
+  const std::string json = "{\"ExampleInt\": 1";
+  CHECK_THROWS(test::ExampleJsonSettings("").reloadAllFromCache(std::span<const char>(json.data(), json.size())));
+}
+
+namespace test {
+
+template <class Codec>
+class ExamplePackedSettings
+    : public util::Settings<std::variant<int*, double*, std::vector<double>*, std::vector<unsigned>*>, Codec> {
+  using Base = util::Settings<std::variant<int*, double*, std::vector<double>*, std::vector<unsigned>*>, Codec>;
+
+ public:
+  ExamplePackedSettings(const std::string& source_file_name)
+      : Base(source_file_name) {
+    const bool dont_throw_bad_parsing = true;
+    this->template put<int, NUM_VALS>(i_array.data(), EXAMPLE_ARRAY_I, dont_throw_bad_parsing);
+    this->template put<double, NUM_VALS>(d_array.data(), EXAMPLE_ARRAY_D, dont_throw_bad_parsing);
+    this->put(&doubles, EXAMPLE_VECTOR_I, dont_throw_bad_parsing);
+    this->put(&empty, EXAMPLE_SET_D, dont_throw_bad_parsing);
+  }
+
+  std::array<int, NUM_VALS> i_array    = TEST_ARRAY_I;
+  std::array<double, NUM_VALS> d_array = TEST_ARRAY_D;
+  std::vector<double> doubles;
+  std::vector<unsigned> empty;
+};
+
+}  // namespace test
+
+TEST_CASE("settings_test_packed_numeric_arrays") {
+  std::remove(SAVE_FILE.c_str());
+
+  test::ExamplePackedSettings<util::PackedXmlCodec> packed(SAVE_FILE);
+  packed.i_array = {{7, -8, 9, -10, 11}};
+  packed.d_array = {{0.1, 1. / 3., -1e-300, 0., 5.}};
+  for (int i = 0; i < 10000; ++i) {
+    packed.doubles.push_back(static_cast<double>(i) / 7.);
+  }
+  packed.save();
+  const auto packed_size = std::filesystem::file_size(SAVE_FILE);
+
+  // One element per variable, the numbers are its text.
+  tinyxml2::XMLDocument settingsDocument;
+  REQUIRE(settingsDocument.LoadFile(SAVE_FILE.c_str()) == tinyxml2::XMLError::XML_SUCCESS);
+  const tinyxml2::XMLElement* i_array =
+    settingsDocument.FirstChild()->FirstChildElement(EXAMPLE_ARRAY_I.c_str());
+  REQUIRE(i_array != nullptr);
+  CHECK(i_array->FirstChildElement() == nullptr);
+  CHECK(std::string(i_array->Attribute("count")) == "5");
+  CHECK(std::string(i_array->GetText()) == "7 -8 9 -10 11");
+
+  // Both codecs load the packed representation.
+  test::ExamplePackedSettings<util::PackedXmlCodec> packed2(SAVE_FILE);
+  test::ExamplePackedSettings<util::XmlCodec> elements(SAVE_FILE);
+  CHECK(packed2.i_array == packed.i_array);
+  CHECK(packed2.d_array == packed.d_array);
+  CHECK(packed2.doubles == packed.doubles);
+  CHECK(packed2.empty.empty());
+  CHECK(elements.i_array == packed.i_array);
+  CHECK(elements.d_array == packed.d_array);
+  CHECK(elements.doubles == packed.doubles);
+  CHECK(elements.empty.empty());
+
+  // Unchanged variables keep their representation until they are written.
+  CHECK(elements.save().empty());
+  CHECK(std::filesystem::file_size(SAVE_FILE) == packed_size);
+
+  // Saving with the default codec switches back to one element per number.
+  elements.markAllChanged();
+  CHECK(elements.save().size() == 4);
+  CHECK(std::filesystem::file_size(SAVE_FILE) > packed_size);
+  test::ExamplePackedSettings<util::PackedXmlCodec> packed3(SAVE_FILE);
+  CHECK(packed3.i_array == packed.i_array);
+  CHECK(packed3.doubles == packed.doubles);
+  std::remove(SAVE_FILE.c_str());
+}
+
+TEST_CASE("settings_test_save_writes_only_changed_variables") {
+  std::remove(SAVE_FILE.c_str());
+  {
+    test::ExampleSettings es(SAVE_FILE);
+    // The file did not exist, put() wrote every variable into the document.
+    CHECK(es.save().empty());
+
+    es.exampleInt = DEF_INT[1];
+    es.exampleStr = DEF_STR[1];
+    CHECK(es.save() == std::vector<std::string>{EXAMPLE_INT, EXAMPLE_STRING});
+    CHECK(es.save().empty());
+
+    // Setting the old value again is no change.
+    es.exampleInt = DEF_INT[2];
+    es.exampleInt = DEF_INT[1];
+    CHECK(es.save().empty());
+  }
+  {
+    test::ExampleSettings es(SAVE_FILE);
+    CHECK(es.exampleInt == DEF_INT[1]);
+    CHECK(es.exampleStr == DEF_STR[1]);
+    CHECK(es.save().empty());
+
+    // The file changed, reloading replaces the document.
+    test::ExampleSettings other(SAVE_FILE);
+    other.exampleDouble = DEF_DOUBLE[2];
+    CHECK(other.save() == std::vector<std::string>{EXAMPLE_DOUBLE});
+    CHECK(es.reloadAllFromFile().empty());
+    CHECK(es.exampleDouble == DEF_DOUBLE[2]);
+    CHECK(es.save().empty());
+
+    es.markAllChanged();
+    CHECK(es.save().size() == 7);
+  }
+  {
+    // A value changed by the sanitizer on load is written on the next save.
+    test::ExampleSaneSettings es(SAVE_FILE);
+    const std::string xml = "<Settings><" + EXAMPLE_INT + ">500</" + EXAMPLE_INT + "><" +
+                            EXAMPLE_DOUBLE + ">1.5</" + EXAMPLE_DOUBLE + "></Settings>";
+    es.reloadAllFromCache(std::span<const char>(xml.data(), xml.size()));
+    CHECK(es.exampleInt == test::ExampleSaneSettings::RANGE_I.getMax());
+    const std::vector<std::string> written = es.save();
+    CHECK(std::ranges::find(written, EXAMPLE_INT) != written.end());
+    CHECK(std::ranges::find(written, EXAMPLE_DOUBLE) == written.end());
+  }
+  std::remove(SAVE_FILE.c_str());
+}
+
+namespace test {
+
+using UnorderedSettings = util::Settings<std::variant<std::unordered_map<std::string, int>*>>;
+class ExampleUnorderedSettings : public UnorderedSettings {
+ public:
+  ExampleUnorderedSettings(const std::string& source_file_name)
+      : UnorderedSettings(source_file_name) {
+    put<std::unordered_map<std::string, int>>(&map, EXAMPLE_UNORDERED_MAP, true);
+  }
+
+  std::unordered_map<std::string, int> map;
+};
+
+}  // namespace test
+
+TEST_CASE("settings_test_save_skips_unchanged_unordered_container") {
+  std::remove(SAVE_FILE.c_str());
+  {
+    test::ExampleUnorderedSettings es(SAVE_FILE);
+    for (int i = 0; i < 100; ++i) {
+      es.map.emplace(std::to_string(i), i);
+    }
+    CHECK(es.save() == std::vector<std::string>{EXAMPLE_UNORDERED_MAP});
+
+    // Same content with another bucket count and insertion order.
+    std::unordered_map<std::string, int> rebuilt;
+    rebuilt.reserve(1024);
+    for (int i = 99; i >= 0; --i) {
+      rebuilt.emplace(std::to_string(i), i);
+    }
+    es.map = std::move(rebuilt);
+    CHECK(es.save().empty());
+
+    es.map["100"] = 100;
+    CHECK(es.save() == std::vector<std::string>{EXAMPLE_UNORDERED_MAP});
+  }
+  {
+    // The loaded map is built in the order of the file.
+    test::ExampleUnorderedSettings es(SAVE_FILE);
+    CHECK(es.map.size() == 101);
+    CHECK(es.save().empty());
+  }
+  std::remove(SAVE_FILE.c_str());
+}
+
+TEST_CASE("settings_test_atomic_save") {
+  std::remove(SAVE_FILE.c_str());
+  {
+    test::ExampleSettings es(SAVE_FILE);
+    es.setSaveDurability(util::SaveDurability::AtomicSyncAll);
+    es.exampleInt = DEF_INT[2];
+    es.exampleStr = DEF_STR[2];
+    es.save();
+  }
+  test::ExampleSettings es(SAVE_FILE);
+  CHECK(es.exampleInt == DEF_INT[2]);
+  CHECK(es.exampleStr == DEF_STR[2]);
+
+  // Failing to write throws like the direct save.
+  es.setSaveDurability(util::SaveDurability::Atomic);
+  CHECK_THROWS(es.save("not_existing_directory/" + SAVE_FILE));
+  std::remove(SAVE_FILE.c_str());
+}
+
+TEST_CASE("settings_test_save_async") {
+  std::remove(SAVE_FILE.c_str());
+  {
+    // An entry of an unregistered variable is kept.
+    std::ofstream file(SAVE_FILE);
+    file << "<Settings><unknown>7</unknown><" << EXAMPLE_INT << ">1</" << EXAMPLE_INT
+         << "></Settings>";
+  }
+  test::ExampleSettings es(SAVE_FILE);
+  CHECK(es.exampleInt == 1);
+
+  // The async saves are written in order, the last one wins.
+  std::vector<std::future<void>> saves;
+  for (int i = 0; i < 20; ++i) {
+    es.exampleInt = i;
+    es.exampleStr = "value " + std::to_string(i);
+    saves.push_back(es.saveAsync());
+  }
+  // Changes after saveAsync() returned are not part of the save.
+  es.exampleInt = -1;
+  for (std::future<void>& save : saves) {
+    CHECK_NOTHROW(save.get());
+  }
+
+  test::ExampleSettings es2(SAVE_FILE);
+  CHECK(es2.exampleInt == 19);
+  CHECK(es2.exampleStr == "value 19");
+  CHECK(es2.exampleWStr == DEF_WSTR[0]);
+  tinyxml2::XMLDocument settingsDocument;
+  REQUIRE(settingsDocument.LoadFile(SAVE_FILE.c_str()) == tinyxml2::XMLError::XML_SUCCESS);
+  CHECK(settingsDocument.FirstChild()->FirstChildElement("unknown") != nullptr);
+
+  // Errors are reported through the future.
+  es.setSaveDurability(util::SaveDurability::Atomic);
+  es.reloadAllFromFile("not_existing_directory/" + SAVE_FILE);
+  std::future<void> failed = es.saveAsync();
+  CHECK_THROWS(failed.get());
+  std::remove(SAVE_FILE.c_str());
+}
+
+TEST_CASE("settings_test_request_save") {
+  std::remove(SAVE_FILE.c_str());
+  {
+    test::ExampleSettings es(SAVE_FILE);
+    es.setSaveCoalescing(std::chrono::seconds(60), std::chrono::seconds(60));
+    for (int i = 0; i < 100; ++i) {
+      es.exampleInt = i;
+      es.requestSave();
+    }
+    CHECK_NOTHROW(es.flushSaves());
+    const util::SaveCounters counters = es.saveCounters();
+    CHECK(counters.requested == 100);
+    CHECK(counters.performed == 1);
+    test::ExampleSettings es2(SAVE_FILE);
+    CHECK(es2.exampleInt == 99);
+
+    // Written on destruction.
+    es.exampleStr = "pending";
+    es.requestSave();
+  }
+  test::ExampleSettings es3(SAVE_FILE);
+  CHECK(es3.exampleStr == "pending");
+  CHECK(es3.saveCounters().requested == 0);
+  std::remove(SAVE_FILE.c_str());
+}
+
+#if SETTINGS_HAS_INOTIFY
+TEST_CASE("settings_test_watch_source_file") {
+  std::remove(SAVE_FILE.c_str());
+  test::ExampleSettings es(SAVE_FILE);
+  es.save();
+  REQUIRE(es.watchSourceFile(std::chrono::milliseconds(20)));
+
+  // Own saves do not count as change.
+  es.exampleInt = 5;
+  es.save();
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  CHECK_FALSE(es.reloadIfSourceChanged().has_value());
+
+  // Someone else replaces the file.
+  {
+    test::ExampleSettings other(SAVE_FILE);
+    other.exampleInt = 42;
+    other.setSaveDurability(util::SaveDurability::Atomic);
+    other.save();
+  }
+  std::optional<std::vector<std::string>> reloaded;
+  for (int i = 0; i < 400 && !reloaded.has_value(); ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    reloaded = es.reloadIfSourceChanged();
+  }
+  REQUIRE(reloaded.has_value());
+  CHECK(reloaded->empty());
+  CHECK(es.exampleInt == 42);
+
+  es.stopWatchingSourceFile();
+  std::remove(SAVE_FILE.c_str());
+}
+#endif
+
+TEST_CASE("settings_test_reload_changed_from_file") {
+  std::remove(SAVE_FILE.c_str());
+  test::ExampleSettings es(SAVE_FILE);
+  es.save();
+
+  // Nothing changed in the file.
+  util::ReloadResult result = es.reloadChangedFromFile();
+  CHECK(result.changed.empty());
+  CHECK(result.bad_variables.empty());
+
+  // Someone else changes one entry. The value changed in memory is not
+  // reloaded, its entry did not change.
+  {
+    test::ExampleSettings other(SAVE_FILE);
+    other.exampleInt = 42;
+    other.save();
+  }
+  es.exampleStr = "changed in memory";
+  result        = es.reloadChangedFromFile();
+  CHECK(result.changed == std::vector<std::string>{EXAMPLE_INT});
+  CHECK(result.bad_variables.empty());
+  CHECK(es.exampleInt == 42);
+  CHECK(es.exampleStr == "changed in memory");
+
+  // Unchanged variables keep their fingerprint, save() only writes the string.
+  CHECK(es.save() == std::vector<std::string>{EXAMPLE_STRING});
+
+  // A removed entry is reported as bad and loaded again once it is back.
+  {
+    std::ofstream file(SAVE_FILE);
+    file << "<Settings><" << EXAMPLE_INT << ">7</" << EXAMPLE_INT << "></Settings>";
+  }
+  result = es.reloadChangedFromFile();
+  CHECK(result.changed == std::vector<std::string>{EXAMPLE_INT});
+  CHECK(result.bad_variables.size() == 6);
+  CHECK(es.exampleInt == 7);
+  std::remove(SAVE_FILE.c_str());
+}
+
+TEST_CASE("settings_test_published") {
+  std::remove(SAVE_FILE.c_str());
+  util::Published<test::ExampleSettings> published(
+    [] { return std::make_unique<test::ExampleSettings>(SAVE_FILE); });
+  util::Published<test::ExampleSettings>::Reader reader = published.reader();
+  CHECK(reader.get().exampleInt == DEF_INT[0]);
+  {
+    test::ExampleSettings writer(SAVE_FILE);
+    writer.exampleInt = 42;
+    writer.exampleStr = "published";
+    writer.save();
+  }
+  const test::ExampleSettings& before = reader.get();
+  published.reload();
+  // The instance the reader holds is not touched by the reload.
+  CHECK(before.exampleInt == DEF_INT[0]);
+  const test::ExampleSettings& after = reader.get();
+  CHECK(after.exampleInt == 42);
+  CHECK(after.exampleStr == "published");
+  std::remove(SAVE_FILE.c_str());
+}
+
+#if SETTINGS_HAS_SHM
+TEST_CASE("settings_test_shared_memory") {
+  const std::string name = "/settings_test_settings_" + std::to_string(::getpid());
+  util::SharedMemorySegment::remove(name);
+  std::remove(SAVE_FILE.c_str());
+
+  test::ExampleSettings publisher(SAVE_FILE);
+  util::SharedMemorySegment publish_segment(name, 4096);
+  REQUIRE(publish_segment.status() == util::SharedMemorySegment::Status::Ok);
+  publisher.exampleInt = 42;
+  publisher.exampleStr = "shared";
+  CHECK(publisher.publishToSharedMemory(publish_segment));
+
+  test::ExampleSettings es("");
+  util::SharedMemorySegment segment(name);
+  REQUIRE(segment.status() == util::SharedMemorySegment::Status::Ok);
+  std::optional<std::vector<std::string>> bad = es.reloadFromSharedMemory(segment);
+  REQUIRE(bad.has_value());
+  CHECK(bad->empty());
+  CHECK(es.exampleInt == 42);
+  CHECK(es.exampleStr == "shared");
+
+  // Only newer publications are loaded.
+  es.exampleInt = 0;
+  CHECK_FALSE(es.reloadFromSharedMemory(segment).has_value());
+  CHECK(es.exampleInt == 0);
+  publisher.exampleInt = 43;
+  CHECK(publisher.publishToSharedMemory(publish_segment));
+  CHECK(es.reloadFromSharedMemory(segment).has_value());
+  CHECK(es.exampleInt == 43);
+
+  // The publisher reopens the segment with a larger capacity. The attached
+  // reader still loads the next publication.
+  util::SharedMemorySegment grown_segment(name, 8192);
+  REQUIRE(grown_segment.status() == util::SharedMemorySegment::Status::Ok);
+  publisher.exampleInt = 44;
+  CHECK(publisher.publishToSharedMemory(grown_segment));
+  CHECK(es.reloadFromSharedMemory(segment).has_value());
+  CHECK(es.exampleInt == 44);
+
+  // Too small for the values.
+  const std::string small_name = name + "_small";
+  util::SharedMemorySegment small_segment(small_name, 8);
+  CHECK_FALSE(publisher.publishToSharedMemory(small_segment));
+
+  util::SharedMemorySegment::remove(small_name);
+  util::SharedMemorySegment::remove(name);
+}
+#endif
+
+namespace test {
+
+class ExampleLazySettings : public SettingsClass {
+ public:
+  ExampleLazySettings(const std::string& source_file_name, bool ignore_read_error)
+      : SettingsClass(source_file_name) {
+    setLazyLoading(true);
+    put<int>(&exampleInt, EXAMPLE_INT, ignore_read_error);
+    put<std::string>(&exampleStr, EXAMPLE_STRING, ignore_read_error);
+    put<double>(&exampleDouble, EXAMPLE_DOUBLE, ignore_read_error);
+  }
+
+  int exampleInt         = DEF_INT[0];
+  std::string exampleStr = DEF_STR[0];
+  double exampleDouble   = DEF_DOUBLE[0];
+};
+
+}  // namespace test
+
+TEST_CASE("settings_test_lazy_loading") {
+  std::remove(SAVE_FILE.c_str());
+  {
+    std::ofstream file(SAVE_FILE);
+    file << "<Settings><" << EXAMPLE_INT << ">42</" << EXAMPLE_INT << "><" << EXAMPLE_STRING
+         << ">stored</" << EXAMPLE_STRING << "></Settings>";
+  }
+  test::ExampleLazySettings es(SAVE_FILE, false);
+  // Registered, but not loaded yet. The double has no entry, it got saved.
+  CHECK_FALSE(es.isMaterialized(EXAMPLE_INT));
+  CHECK(es.isMaterialized(EXAMPLE_DOUBLE));
+  CHECK(es.exampleInt == DEF_INT[0]);
+
+  CHECK(es.materialize(EXAMPLE_INT));
+  CHECK(es.isMaterialized(EXAMPLE_INT));
+  CHECK(es.exampleInt == 42);
+  CHECK_FALSE(es.materialize("not_registered"));
+
+  // save() keeps the entry of the string which was not loaded yet.
+  CHECK(es.save().empty());
+  CHECK(es.exampleStr == DEF_STR[0]);
+  CHECK(es.materializeAll().empty());
+  CHECK(es.exampleStr == "stored");
+
+  // Read errors are reported when the variable is materialized.
+  {
+    std::ofstream file(SAVE_FILE);
+    file << "<Settings><" << EXAMPLE_INT << ">no number</" << EXAMPLE_INT << "></Settings>";
+  }
+  test::ExampleLazySettings bad(SAVE_FILE, false);
+  CHECK_THROWS(bad.materialize(EXAMPLE_INT));
+  test::ExampleLazySettings ignored(SAVE_FILE, true);
+  CHECK(ignored.materializeAll() == std::vector<std::string>{EXAMPLE_INT});
+  CHECK(ignored.exampleInt == DEF_INT[0]);
+  std::remove(SAVE_FILE.c_str());
+}
+
+namespace {
+
+std::string readFile(const std::string& path) {
+  std::ifstream file(path, std::ios::binary);
+  return std::string((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+}
+
+}  // namespace
+
+TEST_CASE("settings_test_save_streaming") {
+  std::remove(SAVE_FILE.c_str());
+  std::remove(SAVE_FILE_MOVE.c_str());
+  const std::string xml = "<?xml version=\"1.0\"?>\n<!-- kept -->\n<Settings version=\"2\"><unknown>7</unknown><" +
+                          EXAMPLE_INT + ">1</" + EXAMPLE_INT + "></Settings>\n";
+  for (const std::string& file : {SAVE_FILE, SAVE_FILE_MOVE}) {
+    std::ofstream out(file);
+    out << xml;
+  }
+
+  // The same values saved through the document and streamed give the same file.
+  test::ExampleSettings dom(SAVE_FILE);
+  test::ExampleSettings streamed(SAVE_FILE_MOVE);
+  for (test::ExampleSettings* es : {&dom, &streamed}) {
+    es->exampleInt  = 42;
+    es->exampleStr  = "";
+    es->exampleWStr = DEF_WSTR[1];
+  }
+  dom.markAllChanged();
+  dom.save();
+  streamed.saveStreaming();
+  CHECK(readFile(SAVE_FILE) == readFile(SAVE_FILE_MOVE));
+
+  test::ExampleSettings reloaded(SAVE_FILE_MOVE);
+  CHECK(reloaded.exampleInt == 42);
+  CHECK(reloaded.exampleStr.empty());
+  CHECK(reloaded.exampleWStr == DEF_WSTR[1]);
+
+  // The document was not changed, the next save() writes everything again.
+  streamed.exampleInt = 43;
+  CHECK(streamed.save().size() == 7);
+
+  // Containers, packed and as elements.
+  std::remove(SAVE_FILE.c_str());
+  std::remove(SAVE_FILE_MOVE.c_str());
+  auto check = [](auto& es, const std::string& file) {
+    es.doubles = {1.5, -2., 1e-300};
+    es.i_array = {{7, -8, 9, -10, 11}};
+    es.markAllChanged();
+    es.save();
+    const std::string saved = readFile(file);
+    es.saveStreaming();
+    CHECK(readFile(file) == saved);
+  };
+  test::ExamplePackedSettings<util::XmlCodec> elements(SAVE_FILE);
+  check(elements, SAVE_FILE);
+  test::ExamplePackedSettings<util::PackedXmlCodec> packed(SAVE_FILE_MOVE);
+  check(packed, SAVE_FILE_MOVE);
+  std::remove(SAVE_FILE.c_str());
+  std::remove(SAVE_FILE_MOVE.c_str());
+}
+
+TEST_CASE("settings_test_reload_all_streaming") {
+  std::remove(SAVE_FILE.c_str());
+  test::ExampleSettings es(SAVE_FILE);
+  test::ExampleSettings dom(SAVE_FILE);
+  {
+    std::ofstream file(SAVE_FILE);
+    file << "<?xml version=\"1.0\"?>\n<!-- kept -->\n<Settings version=\"2\">"
+         << "<unknown><_0>7</_0></unknown>"
+         << "<" << EXAMPLE_INT << ">42</" << EXAMPLE_INT << ">"
+         << "<" << EXAMPLE_STRING << ">streamed</" << EXAMPLE_STRING << ">"
+         << "<" << EXAMPLE_DOUBLE << ">not a number</" << EXAMPLE_DOUBLE << ">"
+         << "</Settings>\n";
+  }
+
+  // Same result as the reload through the document.
+  std::vector<std::string> bad_variables = es.reloadAllStreaming();
+  std::vector<std::string> dom_bad_variables = dom.reloadAllFromFile();
+  std::sort(bad_variables.begin(), bad_variables.end());
+  std::sort(dom_bad_variables.begin(), dom_bad_variables.end());
+  CHECK(bad_variables.size() == 5);
+  CHECK(bad_variables == dom_bad_variables);
+  CHECK(es.exampleInt == 42);
+  CHECK(es.exampleStr == "streamed");
+
+  // The rest of the file is kept, the loaded variables are all written again.
+  CHECK(es.save().size() == 7);
+  const std::string saved = readFile(SAVE_FILE);
+  CHECK(saved.find("<!-- kept -->") != std::string::npos);
+  CHECK(saved.find("version=\"2\"") != std::string::npos);
+  CHECK(saved.find("<unknown>") != std::string::npos);
+  test::ExampleSettings reloaded(SAVE_FILE);
+  CHECK(reloaded.exampleInt == 42);
+  CHECK(reloaded.exampleStr == "streamed");
+
+  // A broken file throws like reloadAllFromFile(), a missing one is reported.
+  {
+    std::ofstream file(SAVE_FILE);
+    file << "<Settings><" << EXAMPLE_INT << ">1</Settings";
+  }
+  CHECK_THROWS_AS(es.reloadAllStreaming(), std::runtime_error);
+  std::remove(SAVE_FILE.c_str());
+  CHECK(es.reloadAllStreaming().size() == 7);
+}
+
+#if defined(__linux__)
+
+namespace {
+
+/*!
+ * @brief A field of /proc/self/status in kB, like "VmRSS:" or "VmHWM:" (the
+ * peak resident memory).
+ */
+size_t residentKb(std::string_view field) {
+  std::ifstream status("/proc/self/status");
+  std::string line;
+  while (std::getline(status, line)) {
+    if (line.starts_with(field)) {
+      return static_cast<size_t>(std::stoul(line.substr(field.size())));
+    }
+  }
+  return 0;
+}
+
+/*!
+ * @brief How much the peak resident memory grows while function runs, in kB.
+ * @return std::nullopt if the peak can not be reset.
+ */
+template <class Function>
+std::optional<size_t> peakIncreaseKb(Function&& function) {
+#if defined(__GLIBC__)
+  // Memory freed by earlier tests would hide the growth.
+  malloc_trim(0);
+#endif
+  {
+    std::ofstream clear_refs("/proc/self/clear_refs");
+    clear_refs << "5";
+    if (!clear_refs) {
+      return std::nullopt;
+    }
+  }
+  const size_t before = residentKb("VmHWM:");
+  if (before == 0 || before > residentKb("VmRSS:") + 1024) {
+    return std::nullopt;
+  }
+  std::forward<Function>(function)();
+  return residentKb("VmHWM:") - before;
+}
+
+}  // namespace
+
+namespace test {
+
+class ExampleStreamedSettings : public LargeContainerSettings {
+ public:
+  ExampleStreamedSettings(const std::string& source_file_name, size_t num_entries)
+      : LargeContainerSettings(source_file_name),
+        vectors(num_entries) {
+    const bool dont_throw_bad_parsing = true;
+    for (size_t i = 0; i < vectors.size(); ++i) {
+      put(&vectors[i], "streamed_" + std::to_string(i), dont_throw_bad_parsing);
+    }
+  }
+
+  std::vector<std::vector<unsigned>> vectors;
+};
+
+}  // namespace test
+
+TEST_CASE("settings_test_reload_all_streaming_memory") {
+  constexpr size_t NUM_ENTRIES  = 16;
+  constexpr size_t NUM_ELEMENTS = 10000;
+  std::remove(SAVE_FILE.c_str());
+  // Created before the file exists, so neither holds its document yet.
+  test::ExampleStreamedSettings streamed(SAVE_FILE, NUM_ENTRIES);
+  test::ExampleStreamedSettings dom(SAVE_FILE, NUM_ENTRIES);
+  {
+    test::ExampleStreamedSettings writer(SAVE_FILE, NUM_ENTRIES);
+    for (std::vector<unsigned>& vector : writer.vectors) {
+      vector.resize(NUM_ELEMENTS);
+      std::iota(vector.begin(), vector.end(), 0U);
+    }
+    writer.save();
+  }
+
+  const std::optional<size_t> streamed_kb =
+    peakIncreaseKb([&streamed] { CHECK(streamed.reloadAllStreaming().empty()); });
+  const std::optional<size_t> dom_kb =
+    peakIncreaseKb([&dom] { CHECK(dom.reloadAllFromFile().empty()); });
+  CHECK(streamed.vectors == dom.vectors);
+  CHECK(streamed.vectors.back().size() == NUM_ELEMENTS);
+  if (!streamed_kb || !dom_kb) {
+    WARN("The peak resident memory can not be reset, memory not compared.");
+  } else {
+    // The document of the whole file holds a node per number, the streaming
+    // load only the nodes of the current entry.
+    CHECK(*streamed_kb * 2 < *dom_kb);
+  }
+  std::remove(SAVE_FILE.c_str());
+}
+
+#endif
+
+namespace test {
+
+// Registers types which the variant of the Settings class does not list.
+template <class Codec>
+class ExampleUnlistedSettings : public util::Settings<std::variant<int*>, Codec> {
+  using Base = util::Settings<std::variant<int*>, Codec>;
+
+ public:
+  ExampleUnlistedSettings(const std::string& source_file_name)
+      : Base(source_file_name) {
+    const bool dont_throw_bad_parsing = true;
+    this->put(&number, EXAMPLE_INT, dont_throw_bad_parsing);
+    this->put(&doubles, EXAMPLE_VECTOR_I, dont_throw_bad_parsing);
+    this->put(&names, EXAMPLE_STRING, dont_throw_bad_parsing);
+    this->template put<float, NUM_VALS>(floats.data(), EXAMPLE_ARRAY_F, dont_throw_bad_parsing);
+  }
+
+  int number = 0;
+  std::vector<double> doubles;
+  std::map<int, std::string> names;
+  std::array<float, NUM_VALS> floats{};
+};
+
+}  // namespace test
+
+TEST_CASE("settings_test_types_not_in_variant") {
+  auto check = [](auto& saved, auto& loaded) {
+    saved.number  = 3;
+    saved.doubles = {1.5, -2.};
+    saved.names   = {{1, "one"}, {2, "two"}};
+    saved.floats  = TEST_ARRAY_F;
+    saved.save();
+    CHECK(loaded.reloadAllFromFile().empty());
+    CHECK(loaded.number == 3);
+    CHECK(loaded.doubles == saved.doubles);
+    CHECK(loaded.names == saved.names);
+    CHECK(loaded.floats == TEST_ARRAY_F);
+
+    CHECK(loaded.reloadAllFromBinary(saved.saveBinary()).empty());
+    CHECK(loaded.names == saved.names);
+  };
+  std::remove(SAVE_FILE.c_str());
+  test::ExampleUnlistedSettings<util::XmlCodec> xml_saved(SAVE_FILE);
+  test::ExampleUnlistedSettings<util::XmlCodec> xml_loaded(SAVE_FILE);
+  check(xml_saved, xml_loaded);
+  std::remove(SAVE_FILE.c_str());
+  test::ExampleUnlistedSettings<util::JsonCodec> json_saved(SAVE_FILE);
+  test::ExampleUnlistedSettings<util::JsonCodec> json_loaded(SAVE_FILE);
+  check(json_saved, json_loaded);
+  std::remove(SAVE_FILE.c_str());
+}
+
+TEST_CASE("settings_test_packed_numeric_arrays_wrong_count") {
+  test::ExamplePackedSettings<util::XmlCodec> es("");
+  const std::string xml =
+    "<Settings>"
+    "<" + EXAMPLE_ARRAY_I + " count=\"4\">1 2 3 4</" + EXAMPLE_ARRAY_I + ">"
+    "<" + EXAMPLE_ARRAY_D + " count=\"5\">1 2 3 4</" + EXAMPLE_ARRAY_D + ">"
+    "<" + EXAMPLE_VECTOR_I + " count=\"3\">1 2 x</" + EXAMPLE_VECTOR_I + ">"
+    "<" + EXAMPLE_SET_D + " count=\"1000\">1</" + EXAMPLE_SET_D + ">"
+    "</Settings>";
+  const std::vector<std::string> bad =
+    es.reloadAllFromCache(std::span<const char>(xml.data(), xml.size()));
+  CHECK(bad.size() == 4);
+  CHECK(es.i_array == TEST_ARRAY_I);
+}
+
+namespace test {
+
+// Registers the same variables as ExampleUnlistedSettings through a Schema,
+// the numbers are a C array.
+template <class Codec>
+class ExampleSchemaSettings : public util::Settings<std::variant<int*>, Codec> {
+  using Base = util::Settings<std::variant<int*>, Codec>;
+
+ public:
+  ExampleSchemaSettings(const std::string& source_file_name)
+      : Base(source_file_name) {
+    this->template registerSchema<Schema>(this);
+  }
+
+  int number = 0;
+  std::vector<double> doubles;
+  std::map<int, std::string> names;
+  float floats[NUM_VALS]{};
+
+  // After the members, they must be declared to take their address.
+  using Schema = util::Schema<util::Field<"ExampleInt", &ExampleSchemaSettings::number, false>,
+                              util::Field<"test_vector_i", &ExampleSchemaSettings::doubles, true>,
+                              util::Field<"ExampleStr", &ExampleSchemaSettings::names, true>,
+                              util::Field<"test_array_f", &ExampleSchemaSettings::floats, true>>;
+};
+
+}  // namespace test
+
+TEST_CASE("settings_test_schema") {
+  auto check = [](auto& by_put, auto& by_schema) {
+    by_put.number  = 3;
+    by_put.doubles = {1.5, -2.};
+    by_put.names   = {{1, "one"}, {2, "two"}};
+    by_put.floats  = TEST_ARRAY_F;
+    by_put.save();
+    CHECK(by_schema.reloadAllFromFile().empty());
+    CHECK(by_schema.number == 3);
+    CHECK(by_schema.doubles == by_put.doubles);
+    CHECK(by_schema.names == by_put.names);
+    CHECK(std::equal(std::begin(by_schema.floats), std::end(by_schema.floats), TEST_ARRAY_F.begin()));
+
+    by_schema.number = 4;
+    by_schema.names  = {{3, "three"}};
+    by_schema.save();
+    CHECK(by_put.reloadAllFromFile().empty());
+    CHECK(by_put.number == 4);
+    CHECK(by_put.names == by_schema.names);
+  };
+  std::remove(SAVE_FILE.c_str());
+  test::ExampleUnlistedSettings<util::XmlCodec> xml_by_put(SAVE_FILE);
+  test::ExampleSchemaSettings<util::XmlCodec> xml_by_schema(SAVE_FILE);
+  check(xml_by_put, xml_by_schema);
+  {
+    // Loaded by the constructor, in the order of the file.
+    test::ExampleSchemaSettings<util::XmlCodec> xml_loaded(SAVE_FILE);
+    CHECK(xml_loaded.number == 4);
+    CHECK(xml_loaded.doubles == xml_by_put.doubles);
+    CHECK(xml_loaded.floats[1] == TEST_ARRAY_F[1]);
+  }
+  std::remove(SAVE_FILE.c_str());
+  test::ExampleUnlistedSettings<util::JsonCodec> json_by_put(SAVE_FILE);
+  test::ExampleSchemaSettings<util::JsonCodec> json_by_schema(SAVE_FILE);
+  check(json_by_put, json_by_schema);
+  std::remove(SAVE_FILE.c_str());
+
+  {
+    // The missing entries are appended, a corrupted number throws (the
+    // Field does not ignore read errors).
+    std::ofstream file(SAVE_FILE);
+    file << "<Settings><test_vector_i><_0>1</_0></test_vector_i><ExampleInt>x</ExampleInt></Settings>";
+  }
+  CHECK_THROWS(test::ExampleSchemaSettings<util::XmlCodec>(SAVE_FILE));
+  {
+    std::ofstream file(SAVE_FILE);
+    file << "<Settings><test_vector_i><_0>1</_0></test_vector_i></Settings>";
+  }
+  test::ExampleSchemaSettings<util::XmlCodec> partial(SAVE_FILE);
+  CHECK(partial.doubles == std::vector<double>{1.});
+  partial.save();
+  test::ExampleUnlistedSettings<util::XmlCodec> appended(SAVE_FILE);
+  CHECK(appended.reloadAllFromFile().empty());
+  std::remove(SAVE_FILE.c_str());
+}
+
 // NOLINTEND (readability-magic-numbers)
 // NOLINTEND (modernize-avoid-c-arrays)
 // NOLINTEND (readability-function-cognitive-complexity)
@@ -0,0 +1,132 @@
+/**
+ * @file test_sharedMemory.cpp
+ * @brief contains the unit tests using catch2 for the shared memory segment of the Settings class.
+ *
+ * @date 16.10.2026
+ * @author Jakob Wandel
+ * @version 1.0
+ **/
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+#include <settings/sharedMemory.hpp>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if SETTINGS_HAS_SHM
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+// NOLINTBEGIN (readability-function-cognitive-complexity) I blame the catch2 Macros
+
+#if SETTINGS_HAS_SHM
+
+namespace {
+
+// Unique per process, so parallel test runs do not share the segment.
+std::string segmentName() { return "/settings_test_" + std::to_string(::getpid()); }
+
+std::vector<char> bytesOf(std::string_view text) {
+  return std::vector<char>(text.begin(), text.end());
+}
+
+}  // namespace
+
+TEST_CASE("shared_memory_publish_and_read") {
+  const std::string name = segmentName();
+  util::SharedMemorySegment::remove(name);
+
+  const util::SharedMemorySegment missing(name);
+  CHECK(missing.status() == util::SharedMemorySegment::Status::NotFound);
+
+  util::SharedMemorySegment publisher(name, 16);
+  REQUIRE(publisher.status() == util::SharedMemorySegment::Status::Ok);
+  CHECK(publisher.capacity() == 16);
+
+  util::SharedMemorySegment reader(name);
+  REQUIRE(reader.status() == util::SharedMemorySegment::Status::Ok);
+  std::vector<char> bytes;
+  uint64_t generation = 0;
+  // Nothing published yet.
+  CHECK_FALSE(reader.read(bytes, generation));
+  CHECK(reader.generation() == 0);
+
+  CHECK(publisher.publish(bytesOf("first")));
+  REQUIRE(reader.read(bytes, generation));
+  CHECK(bytes == bytesOf("first"));
+  const uint64_t first_generation = generation;
+
+  CHECK(publisher.publish(bytesOf("second")));
+  REQUIRE(reader.read(bytes, generation));
+  CHECK(bytes == bytesOf("second"));
+  CHECK(generation > first_generation);
+  CHECK(reader.generation() == generation);
+
+  // Too large, the last publication stays.
+  CHECK_FALSE(publisher.publish(bytesOf("does not fit into 16 bytes")));
+  // Attached read-only.
+  CHECK_FALSE(reader.publish(bytesOf("x")));
+  REQUIRE(reader.read(bytes, generation));
+  CHECK(bytes == bytesOf("second"));
+
+  // Another process reads the publication.
+  const pid_t child = ::fork();
+  if (child == 0) {
+    util::SharedMemorySegment child_reader(name);
+    std::vector<char> child_bytes;
+    uint64_t child_generation = 0;
+    const bool ok = child_reader.read(child_bytes, child_generation) &&
+                    child_bytes == bytesOf("second");
+    ::_exit(ok ? 0 : 1);
+  }
+  REQUIRE(child > 0);
+  int child_status = -1;
+  ::waitpid(child, &child_status, 0);
+  CHECK(WIFEXITED(child_status));
+  CHECK(WEXITSTATUS(child_status) == 0);
+
+  CHECK(util::SharedMemorySegment::remove(name));
+}
+
+TEST_CASE("shared_memory_grow") {
+  const std::string name = segmentName() + "_grow";
+  util::SharedMemorySegment::remove(name);
+
+  util::SharedMemorySegment publisher(name, 16);
+  REQUIRE(publisher.status() == util::SharedMemorySegment::Status::Ok);
+  util::SharedMemorySegment reader(name);
+  REQUIRE(reader.status() == util::SharedMemorySegment::Status::Ok);
+  CHECK(publisher.publish(bytesOf("first")));
+  std::vector<char> bytes;
+  uint64_t generation = 0;
+  REQUIRE(reader.read(bytes, generation));
+  const uint64_t first_generation = generation;
+
+  // Reopened with a larger capacity: the publication is kept, the generation
+  // keeps increasing.
+  util::SharedMemorySegment grown(name, 1 << 20);
+  REQUIRE(grown.status() == util::SharedMemorySegment::Status::Ok);
+  CHECK(grown.capacity() == 1 << 20);
+  CHECK(grown.generation() > first_generation);
+  REQUIRE(reader.read(bytes, generation));
+  CHECK(bytes == bytesOf("first"));
+  const uint64_t grown_generation = generation;
+  CHECK(grown_generation > first_generation);
+
+  // A publication larger than the mapping of the attached reader.
+  const std::vector<char> large(1 << 20, 'x');
+  CHECK(grown.publish(large));
+  REQUIRE(reader.read(bytes, generation));
+  CHECK(bytes == large);
+  CHECK(generation > grown_generation);
+  CHECK(reader.capacity() == 1 << 20);
+
+  CHECK(util::SharedMemorySegment::remove(name));
+}
+
+#endif
+
+// NOLINTEND (readability-function-cognitive-complexity)
@@ -0,0 +1,74 @@
+/**
+ * @file test_xmlScanner.cpp
+ * @brief contains the unit tests using catch2 for the scanner of the elements below the root.
+ *
+ * @date 16.10.2026
+ * @author Jakob Wandel
+ * @version 1.0
+ **/
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <settings/xmlScanner.hpp>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// NOLINTBEGIN (readability-function-cognitive-complexity) I blame the catch2 Macros
+
+namespace {
+
+using Children = std::vector<std::pair<std::string, std::string>>;
+
+bool scan(std::string_view xml, Children& children) {
+  children.clear();
+  return util::scanTopLevelElements(xml, [&children](std::string_view name, std::string_view element) {
+    children.emplace_back(name, element);
+  });
+}
+
+}  // namespace
+
+TEST_CASE("xml_scanner_top_level_elements") {
+  Children children;
+  const std::string xml =
+    "\xEF\xBB\xBF<?xml version=\"1.0\"?>\n"
+    "<!DOCTYPE Settings [<!ENTITY e \"x>\">]>\n"
+    "<!-- <not> an element -->\n"
+    "<Settings version=\"2\">\n"
+    "  <a>1</a>\n"
+    "  <!-- <b>2</b> -->\n"
+    "  <list><_0>1</_0><_1 x=\"a>b\"/><_2><![CDATA[</list>]]></_2></list>\n"
+    "  <empty/>\n"
+    "  <empty attribute='/>'/>\n"
+    "</Settings>\n"
+    "<!-- tail -->\n";
+  REQUIRE(scan(xml, children));
+  const Children expected = {
+    {"a", "<a>1</a>"},
+    {"list", "<list><_0>1</_0><_1 x=\"a>b\"/><_2><![CDATA[</list>]]></_2></list>"},
+    {"empty", "<empty/>"},
+    {"empty", "<empty attribute='/>'/>"},
+  };
+  CHECK(children == expected);
+
+  CHECK(scan("<Settings/>", children));
+  CHECK(children.empty());
+  CHECK(scan("<Settings></Settings>", children));
+  CHECK(children.empty());
+}
+
+TEST_CASE("xml_scanner_broken_structure") {
+  Children children;
+  CHECK_FALSE(scan("", children));
+  CHECK_FALSE(scan("no xml", children));
+  CHECK_FALSE(scan("<Settings><a>1</a>", children));
+  CHECK_FALSE(scan("<Settings><a>1</a", children));
+  CHECK_FALSE(scan("<Settings><!-- open </Settings>", children));
+  CHECK_FALSE(scan("<Settings><a x=\"1></a></Settings>", children));
+  CHECK_FALSE(scan("</Settings>", children));
+  CHECK_FALSE(scan("<Settings>< /></Settings>", children));
+}
+
+// NOLINTEND (readability-function-cognitive-complexity)